@@ -3,109 +3,61 @@
 #include "cta.h"
 
 const struct di_cta_video_format _di_cta_video_formats[] = {
-	[60] = {
-		.vic = 60,
-		.h_active = 1280,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 59400000,
-		.h_front = 1760,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[65] = {
-		.vic = 65,
-		.h_active = 1280,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 59400000,
-		.h_front = 1760,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[61] = {
-		.vic = 61,
-		.h_active = 1280,
-		.v_active = 720,
+	{
+		.vic = 1,
+		.h_active = 640,
+		.v_active = 480,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 2420,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.pixel_clock_hz = 25175000,
+		.h_front = 16,
+		.h_sync = 96,
+		.h_back = 48,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 10,
+		.v_sync = 2,
+		.v_back = 33,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[66] = {
-		.vic = 66,
-		.h_active = 1280,
-		.v_active = 720,
+	{
+		.vic = 2,
+		.h_active = 720,
+		.v_active = 480,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 2420,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.pixel_clock_hz = 27000000,
+		.h_front = 16,
+		.h_sync = 62,
+		.h_back = 60,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[62] = {
-		.vic = 62,
-		.h_active = 1280,
-		.v_active = 720,
+	{
+		.vic = 3,
+		.h_active = 720,
+		.v_active = 480,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 1760,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 27000000,
+		.h_front = 16,
+		.h_sync = 62,
+		.h_back = 60,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[67] = {
-		.vic = 67,
+	{
+		.vic = 4,
 		.h_active = 1280,
 		.v_active = 720,
 		.interlaced = false,
 		.pixel_clock_hz = 74250000,
-		.h_front = 1760,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[108] = {
-		.vic = 108,
-		.h_active = 1280,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 90000000,
-		.h_front = 960,
+		.h_front = 110,
 		.h_sync = 40,
 		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -115,141 +67,189 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[109] = {
-		.vic = 109,
-		.h_active = 1280,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 90000000,
-		.h_front = 960,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[32] = {
-		.vic = 32,
+	{
+		.vic = 5,
 		.h_active = 1920,
 		.v_active = 1080,
-		.interlaced = false,
+		.interlaced = true,
 		.pixel_clock_hz = 74250000,
-		.h_front = 638,
+		.h_front = 88,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
+		.v_front = 2,
 		.v_sync = 5,
-		.v_back = 36,
+		.v_back = 15,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[72] = {
-		.vic = 72,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 638,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+	{
+		.vic = 6,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 27000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[33] = {
-		.vic = 33,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 528,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+	{
+		.vic = 7,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 27000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[73] = {
-		.vic = 73,
-		.h_active = 1920,
-		.v_active = 1080,
+	{
+		.vic = 8,
+		.h_active = 1440,
+		.v_active = 240,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 528,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.pixel_clock_hz = 27000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 521,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[34] = {
-		.vic = 34,
-		.h_active = 1920,
-		.v_active = 1080,
+	{
+		.vic = 9,
+		.h_active = 1440,
+		.v_active = 240,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 88,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 27000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 521,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[74] = {
-		.vic = 74,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 88,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+	{
+		.vic = 10,
+		.h_active = 2880,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 76,
+		.h_sync = 248,
+		.h_back = 228,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[111] = {
-		.vic = 111,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 638,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+	{
+		.vic = 11,
+		.h_active = 2880,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 76,
+		.h_sync = 248,
+		.h_back = 228,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[112] = {
-		.vic = 112,
+	{
+		.vic = 12,
+		.h_active = 2880,
+		.v_active = 240,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 76,
+		.h_sync = 248,
+		.h_back = 228,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 521,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 13,
+		.h_active = 2880,
+		.v_active = 240,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 76,
+		.h_sync = 248,
+		.h_back = 228,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 521,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 14,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 32,
+		.h_sync = 124,
+		.h_back = 120,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 15,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 32,
+		.h_sync = 124,
+		.h_back = 120,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 16,
 		.h_active = 1920,
 		.v_active = 1080,
 		.interlaced = false,
 		.pixel_clock_hz = 148500000,
-		.h_front = 638,
+		.h_front = 88,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -257,63 +257,47 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 5,
 		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[79] = {
-		.vic = 79,
-		.h_active = 1680,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 59400000,
-		.h_front = 1360,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[80] = {
-		.vic = 80,
-		.h_active = 1680,
-		.v_active = 720,
+	{
+		.vic = 17,
+		.h_active = 720,
+		.v_active = 576,
 		.interlaced = false,
-		.pixel_clock_hz = 59400000,
-		.h_front = 1228,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 27000000,
+		.h_front = 12,
+		.h_sync = 64,
+		.h_back = 68,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.v_front = 5,
 		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[81] = {
-		.vic = 81,
-		.h_active = 1680,
-		.v_active = 720,
+	{
+		.vic = 18,
+		.h_active = 720,
+		.v_active = 576,
 		.interlaced = false,
-		.pixel_clock_hz = 59400000,
-		.h_front = 700,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 27000000,
+		.h_front = 12,
+		.h_sync = 64,
+		.h_back = 68,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.v_front = 5,
 		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[110] = {
-		.vic = 110,
-		.h_active = 1680,
+	{
+		.vic = 19,
+		.h_active = 1280,
 		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 99000000,
-		.h_front = 810,
+		.pixel_clock_hz = 74250000,
+		.h_front = 440,
 		.h_sync = 40,
 		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -321,559 +305,1007 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 5,
 		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[86] = {
-		.vic = 86,
-		.h_active = 2560,
+	{
+		.vic = 20,
+		.h_active = 1920,
 		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 99000000,
-		.h_front = 998,
+		.interlaced = true,
+		.pixel_clock_hz = 74250000,
+		.h_front = 528,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
+		.v_front = 2,
 		.v_sync = 5,
-		.v_back = 11,
+		.v_back = 15,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[87] = {
-		.vic = 87,
-		.h_active = 2560,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 90000000,
-		.h_front = 448,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	{
+		.vic = 21,
+		.h_active = 1440,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 27000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[88] = {
-		.vic = 88,
-		.h_active = 2560,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 118800000,
-		.h_front = 768,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	{
+		.vic = 22,
+		.h_active = 1440,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 27000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[113] = {
-		.vic = 113,
-		.h_active = 2560,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 198000000,
-		.h_front = 998,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 11,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	{
+		.vic = 23,
+		.h_active = 1440,
+		.v_active = 288,
+		.interlaced = false,
+		.pixel_clock_hz = 27000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 424,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[93] = {
-		.vic = 93,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 24,
+		.h_active = 1440,
+		.v_active = 288,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 1276,
-		.h_sync = 88,
-		.h_back = 296,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 27000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 424,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[103] = {
-		.vic = 103,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 25,
+		.h_active = 2880,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 48,
+		.h_sync = 252,
+		.h_back = 276,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 26,
+		.h_active = 2880,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 48,
+		.h_sync = 252,
+		.h_back = 276,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 27,
+		.h_active = 2880,
+		.v_active = 288,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 1276,
-		.h_sync = 88,
-		.h_back = 296,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.pixel_clock_hz = 54000000,
+		.h_front = 48,
+		.h_sync = 252,
+		.h_back = 276,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 424,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[94] = {
-		.vic = 94,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 28,
+		.h_active = 2880,
+		.v_active = 288,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 1056,
-		.h_sync = 88,
-		.h_back = 296,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 54000000,
+		.h_front = 48,
+		.h_sync = 252,
+		.h_back = 276,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 424,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[104] = {
-		.vic = 104,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 29,
+		.h_active = 1440,
+		.v_active = 576,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 1056,
-		.h_sync = 88,
-		.h_back = 296,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.pixel_clock_hz = 54000000,
+		.h_front = 24,
+		.h_sync = 128,
+		.h_back = 136,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
 	},
-	[95] = {
-		.vic = 95,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 30,
+		.h_active = 1440,
+		.v_active = 576,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 176,
-		.h_sync = 88,
-		.h_back = 296,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.pixel_clock_hz = 54000000,
+		.h_front = 24,
+		.h_sync = 128,
+		.h_back = 136,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[105] = {
-		.vic = 105,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 31,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 176,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 148500000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[114] = {
-		.vic = 114,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 32,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 594000000,
-		.h_front = 1276,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 74250000,
+		.h_front = 638,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[116] = {
-		.vic = 116,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 33,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 594000000,
-		.h_front = 1276,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 74250000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[98] = {
-		.vic = 98,
-		.h_active = 4096,
-		.v_active = 2160,
+	{
+		.vic = 34,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 1020,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 74250000,
+		.h_front = 88,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 35,
+		.h_active = 2880,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 64,
+		.h_sync = 248,
+		.h_back = 240,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 36,
+		.h_active = 2880,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 64,
+		.h_sync = 248,
+		.h_back = 240,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 37,
+		.h_active = 2880,
+		.v_active = 576,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 48,
+		.h_sync = 256,
+		.h_back = 272,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 38,
+		.h_active = 2880,
+		.v_active = 576,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 48,
+		.h_sync = 256,
+		.h_back = 272,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 39,
+		.h_active = 1920,
+		.v_active = 1080,
+		.interlaced = true,
+		.pixel_clock_hz = 72000000,
+		.h_front = 32,
+		.h_sync = 168,
+		.h_back = 184,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 23,
+		.v_sync = 5,
+		.v_back = 57,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 40,
+		.h_active = 1920,
+		.v_active = 1080,
+		.interlaced = true,
+		.pixel_clock_hz = 148500000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 2,
+		.v_sync = 5,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 41,
+		.h_active = 1280,
+		.v_active = 720,
+		.interlaced = false,
+		.pixel_clock_hz = 148500000,
+		.h_front = 440,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 42,
+		.h_active = 720,
+		.v_active = 576,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 12,
+		.h_sync = 64,
+		.h_back = 68,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 43,
+		.h_active = 720,
+		.v_active = 576,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 12,
+		.h_sync = 64,
+		.h_back = 68,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 44,
+		.h_active = 1440,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 45,
+		.h_active = 1440,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 46,
+		.h_active = 1920,
+		.v_active = 1080,
+		.interlaced = true,
+		.pixel_clock_hz = 148500000,
+		.h_front = 88,
+		.h_sync = 44,
+		.h_back = 148,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 2,
+		.v_sync = 5,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 47,
+		.h_active = 1280,
+		.v_active = 720,
+		.interlaced = false,
+		.pixel_clock_hz = 148500000,
+		.h_front = 110,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 48,
+		.h_active = 720,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 16,
+		.h_sync = 62,
+		.h_back = 60,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 49,
+		.h_active = 720,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 54000000,
+		.h_front = 16,
+		.h_sync = 62,
+		.h_back = 60,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 50,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 4,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 51,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 54000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 4,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 52,
+		.h_active = 720,
+		.v_active = 576,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 12,
+		.h_sync = 64,
+		.h_back = 68,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 53,
+		.h_active = 720,
+		.v_active = 576,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 12,
+		.h_sync = 64,
+		.h_back = 68,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 39,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 54,
+		.h_active = 1440,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 108000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 55,
+		.h_active = 1440,
+		.v_active = 576,
+		.interlaced = true,
+		.pixel_clock_hz = 108000000,
+		.h_front = 24,
+		.h_sync = 126,
+		.h_back = 138,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 2,
+		.v_sync = 3,
+		.v_back = 19,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 56,
+		.h_active = 720,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 16,
+		.h_sync = 62,
+		.h_back = 60,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 57,
+		.h_active = 720,
+		.v_active = 480,
+		.interlaced = false,
+		.pixel_clock_hz = 108000000,
+		.h_front = 16,
+		.h_sync = 62,
+		.h_back = 60,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 9,
+		.v_sync = 6,
+		.v_back = 30,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 58,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 108000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 4,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+	},
+	{
+		.vic = 59,
+		.h_active = 1440,
+		.v_active = 480,
+		.interlaced = true,
+		.pixel_clock_hz = 108000000,
+		.h_front = 38,
+		.h_sync = 124,
+		.h_back = 114,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.v_front = 4,
+		.v_sync = 3,
+		.v_back = 15,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 60,
+		.h_active = 1280,
+		.v_active = 720,
+		.interlaced = false,
+		.pixel_clock_hz = 59400000,
+		.h_front = 1760,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[99] = {
-		.vic = 99,
-		.h_active = 4096,
-		.v_active = 2160,
+	{
+		.vic = 61,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 968,
-		.h_sync = 88,
-		.h_back = 128,
+		.pixel_clock_hz = 74250000,
+		.h_front = 2420,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[100] = {
-		.vic = 100,
-		.h_active = 4096,
-		.v_active = 2160,
+	{
+		.vic = 62,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 88,
-		.h_sync = 88,
-		.h_back = 128,
+		.pixel_clock_hz = 74250000,
+		.h_front = 1760,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[115] = {
-		.vic = 115,
-		.h_active = 4096,
-		.v_active = 2160,
+	{
+		.vic = 63,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 594000000,
-		.h_front = 1020,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 297000000,
+		.h_front = 88,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[121] = {
-		.vic = 121,
-		.h_active = 5120,
-		.v_active = 2160,
+	{
+		.vic = 64,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 396000000,
-		.h_front = 1996,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 297000000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 22,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[122] = {
-		.vic = 122,
-		.h_active = 5120,
-		.v_active = 2160,
+	{
+		.vic = 65,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 396000000,
-		.h_front = 1696,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 59400000,
+		.h_front = 1760,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 22,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[123] = {
-		.vic = 123,
-		.h_active = 5120,
-		.v_active = 2160,
+	{
+		.vic = 66,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 396000000,
-		.h_front = 664,
-		.h_sync = 88,
-		.h_back = 128,
+		.pixel_clock_hz = 74250000,
+		.h_front = 2420,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 22,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[124] = {
-		.vic = 124,
-		.h_active = 5120,
-		.v_active = 2160,
+	{
+		.vic = 67,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 742500000,
-		.h_front = 746,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 74250000,
+		.h_front = 1760,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 297,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[194] = {
-		.vic = 194,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 68,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 2552,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 74250000,
+		.h_front = 440,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 144,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[202] = {
-		.vic = 202,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 69,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 2552,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 74250000,
+		.h_front = 110,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 144,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[195] = {
-		.vic = 195,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 70,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 2352,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 148500000,
+		.h_front = 440,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[203] = {
-		.vic = 203,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 71,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 2352,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 148500000,
+		.h_front = 110,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[196] = {
-		.vic = 196,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 72,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 552,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 74250000,
+		.h_front = 638,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[204] = {
-		.vic = 204,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 73,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 552,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 74250000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[197] = {
-		.vic = 197,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 74,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 2376000000,
-		.h_front = 2552,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 74250000,
+		.h_front = 88,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 144,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[205] = {
-		.vic = 205,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 75,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 2376000000,
-		.h_front = 2552,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 148500000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 144,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[210] = {
-		.vic = 210,
-		.h_active = 10240,
-		.v_active = 4320,
+	{
+		.vic = 76,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 1485000000,
-		.h_front = 1492,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 148500000,
+		.h_front = 88,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 594,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[211] = {
-		.vic = 211,
-		.h_active = 10240,
-		.v_active = 4320,
+	{
+		.vic = 77,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 1485000000,
-		.h_front = 2492,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 297000000,
+		.h_front = 528,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[212] = {
-		.vic = 212,
-		.h_active = 10240,
-		.v_active = 4320,
+	{
+		.vic = 78,
+		.h_active = 1920,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 1485000000,
-		.h_front = 288,
-		.h_sync = 176,
-		.h_back = 296,
+		.pixel_clock_hz = 297000000,
+		.h_front = 88,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 144,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[213] = {
-		.vic = 213,
-		.h_active = 10240,
-		.v_active = 4320,
+	{
+		.vic = 79,
+		.h_active = 1680,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 2970000000,
-		.h_front = 1492,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 59400000,
+		.h_front = 1360,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 594,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[17] = {
-		.vic = 17,
-		.h_active = 720,
-		.v_active = 576,
+	{
+		.vic = 80,
+		.h_active = 1680,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 12,
-		.h_sync = 64,
-		.h_back = 68,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.pixel_clock_hz = 59400000,
+		.h_front = 1228,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 5,
 		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+		.v_back = 20,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[18] = {
-		.vic = 18,
-		.h_active = 720,
-		.v_active = 576,
+	{
+		.vic = 81,
+		.h_active = 1680,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 12,
-		.h_sync = 64,
-		.h_back = 68,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.pixel_clock_hz = 59400000,
+		.h_front = 700,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 5,
 		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.v_back = 20,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[19] = {
-		.vic = 19,
-		.h_active = 1280,
+	{
+		.vic = 82,
+		.h_active = 1680,
 		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 440,
+		.pixel_clock_hz = 82500000,
+		.h_front = 260,
 		.h_sync = 40,
 		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -881,15 +1313,15 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 5,
 		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[68] = {
-		.vic = 68,
-		.h_active = 1280,
+	{
+		.vic = 83,
+		.h_active = 1680,
 		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 440,
+		.pixel_clock_hz = 99000000,
+		.h_front = 260,
 		.h_sync = 40,
 		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -899,189 +1331,61 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[20] = {
-		.vic = 20,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = true,
-		.pixel_clock_hz = 74250000,
-		.h_front = 528,
-		.h_sync = 44,
-		.h_back = 148,
+	{
+		.vic = 84,
+		.h_active = 1680,
+		.v_active = 720,
+		.interlaced = false,
+		.pixel_clock_hz = 165000000,
+		.h_front = 60,
+		.h_sync = 40,
+		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 2,
+		.v_front = 5,
 		.v_sync = 5,
-		.v_back = 15,
+		.v_back = 95,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[21] = {
-		.vic = 21,
-		.h_active = 1440,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 27000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[22] = {
-		.vic = 22,
-		.h_active = 1440,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 27000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[23] = {
-		.vic = 23,
-		.h_active = 1440,
-		.v_active = 288,
-		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 424,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[24] = {
-		.vic = 24,
-		.h_active = 1440,
-		.v_active = 288,
-		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 424,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[25] = {
-		.vic = 25,
-		.h_active = 2880,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 48,
-		.h_sync = 252,
-		.h_back = 276,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[26] = {
-		.vic = 26,
-		.h_active = 2880,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 48,
-		.h_sync = 252,
-		.h_back = 276,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[27] = {
-		.vic = 27,
-		.h_active = 2880,
-		.v_active = 288,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 48,
-		.h_sync = 252,
-		.h_back = 276,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 424,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[28] = {
-		.vic = 28,
-		.h_active = 2880,
-		.v_active = 288,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 48,
-		.h_sync = 252,
-		.h_back = 276,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 424,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[29] = {
-		.vic = 29,
-		.h_active = 1440,
-		.v_active = 576,
+	{
+		.vic = 85,
+		.h_active = 1680,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 24,
-		.h_sync = 128,
-		.h_back = 136,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.pixel_clock_hz = 198000000,
+		.h_front = 60,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 5,
 		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+		.v_back = 95,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[30] = {
-		.vic = 30,
-		.h_active = 1440,
-		.v_active = 576,
+	{
+		.vic = 86,
+		.h_active = 2560,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 24,
-		.h_sync = 128,
-		.h_back = 136,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
+		.pixel_clock_hz = 99000000,
+		.h_front = 998,
+		.h_sync = 44,
+		.h_back = 148,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 4,
 		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.v_back = 11,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[31] = {
-		.vic = 31,
-		.h_active = 1920,
+	{
+		.vic = 87,
+		.h_active = 2560,
 		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 528,
+		.pixel_clock_hz = 90000000,
+		.h_front = 448,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1089,15 +1393,15 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 5,
 		.v_back = 36,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[75] = {
-		.vic = 75,
-		.h_active = 1920,
+	{
+		.vic = 88,
+		.h_active = 2560,
 		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 528,
+		.pixel_clock_hz = 118800000,
+		.h_front = 768,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1107,87 +1411,119 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[37] = {
-		.vic = 37,
-		.h_active = 2880,
-		.v_active = 576,
-		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 48,
-		.h_sync = 256,
-		.h_back = 272,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[38] = {
-		.vic = 38,
-		.h_active = 2880,
-		.v_active = 576,
+	{
+		.vic = 89,
+		.h_active = 2560,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 48,
-		.h_sync = 256,
-		.h_back = 272,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
+		.pixel_clock_hz = 185625000,
+		.h_front = 548,
+		.h_sync = 44,
+		.h_back = 148,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 4,
 		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.v_back = 36,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[39] = {
-		.vic = 39,
-		.h_active = 1920,
+	{
+		.vic = 90,
+		.h_active = 2560,
 		.v_active = 1080,
-		.interlaced = true,
-		.pixel_clock_hz = 72000000,
-		.h_front = 32,
-		.h_sync = 168,
-		.h_back = 184,
+		.interlaced = false,
+		.pixel_clock_hz = 198000000,
+		.h_front = 248,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 23,
+		.v_front = 4,
 		.v_sync = 5,
-		.v_back = 57,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.v_back = 11,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[82] = {
-		.vic = 82,
-		.h_active = 1680,
-		.v_active = 720,
+	{
+		.vic = 91,
+		.h_active = 2560,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 82500000,
-		.h_front = 260,
-		.h_sync = 40,
-		.h_back = 220,
+		.pixel_clock_hz = 371250000,
+		.h_front = 218,
+		.h_sync = 44,
+		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
+		.v_front = 4,
 		.v_sync = 5,
-		.v_back = 20,
+		.v_back = 161,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[89] = {
-		.vic = 89,
+	{
+		.vic = 92,
 		.h_active = 2560,
 		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 185625000,
+		.pixel_clock_hz = 495000000,
 		.h_front = 548,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 4,
 		.v_sync = 5,
-		.v_back = 36,
+		.v_back = 161,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[96] = {
+	{
+		.vic = 93,
+		.h_active = 3840,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 297000000,
+		.h_front = 1276,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 94,
+		.h_active = 3840,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 297000000,
+		.h_front = 1056,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 95,
+		.h_active = 3840,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 297000000,
+		.h_front = 176,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
 		.vic = 96,
 		.h_active = 3840,
 		.v_active = 2160,
@@ -1203,13 +1539,13 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[106] = {
-		.vic = 106,
+	{
+		.vic = 97,
 		.h_active = 3840,
 		.v_active = 2160,
 		.interlaced = false,
 		.pixel_clock_hz = 594000000,
-		.h_front = 1056,
+		.h_front = 176,
 		.h_sync = 88,
 		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1217,9 +1553,57 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 10,
 		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 98,
+		.h_active = 4096,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 297000000,
+		.h_front = 1020,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+	},
+	{
+		.vic = 99,
+		.h_active = 4096,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 297000000,
+		.h_front = 968,
+		.h_sync = 88,
+		.h_back = 128,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+	},
+	{
+		.vic = 100,
+		.h_active = 4096,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 297000000,
+		.h_front = 88,
+		.h_sync = 88,
+		.h_back = 128,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
 	},
-	[101] = {
+	{
 		.vic = 101,
 		.h_active = 4096,
 		.v_active = 2160,
@@ -1235,141 +1619,109 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
 	},
-	[125] = {
-		.vic = 125,
-		.h_active = 5120,
+	{
+		.vic = 102,
+		.h_active = 4096,
 		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 742500000,
-		.h_front = 1096,
+		.pixel_clock_hz = 594000000,
+		.h_front = 88,
 		.h_sync = 88,
-		.h_back = 296,
+		.h_back = 128,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 8,
 		.v_sync = 10,
 		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
 	},
-	[198] = {
-		.vic = 198,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 103,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 2376000000,
-		.h_front = 2352,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 297000000,
+		.h_front = 1276,
+		.h_sync = 88,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[206] = {
-		.vic = 206,
-		.h_active = 7680,
-		.v_active = 4320,
+	{
+		.vic = 104,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 2376000000,
-		.h_front = 2352,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 297000000,
+		.h_front = 1056,
+		.h_sync = 88,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[214] = {
-		.vic = 214,
-		.h_active = 10240,
-		.v_active = 4320,
+	{
+		.vic = 105,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 2970000000,
-		.h_front = 2492,
-		.h_sync = 176,
-		.h_back = 592,
+		.pixel_clock_hz = 297000000,
+		.h_front = 176,
+		.h_sync = 88,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 16,
-		.v_sync = 20,
-		.v_back = 44,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[1] = {
-		.vic = 1,
-		.h_active = 640,
-		.v_active = 480,
-		.interlaced = false,
-		.pixel_clock_hz = 25175000,
-		.h_front = 16,
-		.h_sync = 96,
-		.h_back = 48,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 10,
-		.v_sync = 2,
-		.v_back = 33,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[2] = {
-		.vic = 2,
-		.h_active = 720,
-		.v_active = 480,
-		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 16,
-		.h_sync = 62,
-		.h_back = 60,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[3] = {
-		.vic = 3,
-		.h_active = 720,
-		.v_active = 480,
+	{
+		.vic = 106,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 16,
-		.h_sync = 62,
-		.h_back = 60,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.pixel_clock_hz = 594000000,
+		.h_front = 1056,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[4] = {
-		.vic = 4,
-		.h_active = 1280,
-		.v_active = 720,
+	{
+		.vic = 107,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 110,
-		.h_sync = 40,
-		.h_back = 220,
+		.pixel_clock_hz = 594000000,
+		.h_front = 176,
+		.h_sync = 88,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[69] = {
-		.vic = 69,
+	{
+		.vic = 108,
 		.h_active = 1280,
 		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 74250000,
-		.h_front = 110,
+		.pixel_clock_hz = 90000000,
+		.h_front = 960,
 		.h_sync = 40,
 		.h_back = 220,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1377,191 +1729,47 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 5,
 		.v_back = 20,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[5] = {
-		.vic = 5,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = true,
-		.pixel_clock_hz = 74250000,
-		.h_front = 88,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 2,
-		.v_sync = 5,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[6] = {
-		.vic = 6,
-		.h_active = 1440,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 27000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[7] = {
-		.vic = 7,
-		.h_active = 1440,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 27000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[8] = {
-		.vic = 8,
-		.h_active = 1440,
-		.v_active = 240,
-		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 521,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[9] = {
-		.vic = 9,
-		.h_active = 1440,
-		.v_active = 240,
-		.interlaced = false,
-		.pixel_clock_hz = 27000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 521,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[10] = {
-		.vic = 10,
-		.h_active = 2880,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 76,
-		.h_sync = 248,
-		.h_back = 228,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[11] = {
-		.vic = 11,
-		.h_active = 2880,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 76,
-		.h_sync = 248,
-		.h_back = 228,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[12] = {
-		.vic = 12,
-		.h_active = 2880,
-		.v_active = 240,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 76,
-		.h_sync = 248,
-		.h_back = 228,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 521,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[13] = {
-		.vic = 13,
-		.h_active = 2880,
-		.v_active = 240,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 76,
-		.h_sync = 248,
-		.h_back = 228,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 521,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[14] = {
-		.vic = 14,
-		.h_active = 1440,
-		.v_active = 480,
+	{
+		.vic = 109,
+		.h_active = 1280,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 32,
-		.h_sync = 124,
-		.h_back = 120,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+		.pixel_clock_hz = 90000000,
+		.h_front = 960,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[15] = {
-		.vic = 15,
-		.h_active = 1440,
-		.v_active = 480,
+	{
+		.vic = 110,
+		.h_active = 1680,
+		.v_active = 720,
 		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 32,
-		.h_sync = 124,
-		.h_back = 120,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.pixel_clock_hz = 99000000,
+		.h_front = 810,
+		.h_sync = 40,
+		.h_back = 220,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 5,
+		.v_sync = 5,
+		.v_back = 20,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[16] = {
-		.vic = 16,
+	{
+		.vic = 111,
 		.h_active = 1920,
 		.v_active = 1080,
 		.interlaced = false,
 		.pixel_clock_hz = 148500000,
-		.h_front = 88,
+		.h_front = 638,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1571,13 +1779,13 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[76] = {
-		.vic = 76,
+	{
+		.vic = 112,
 		.h_active = 1920,
 		.v_active = 1080,
 		.interlaced = false,
 		.pixel_clock_hz = 148500000,
-		.h_front = 88,
+		.h_front = 638,
 		.h_sync = 44,
 		.h_back = 148,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1587,76 +1795,124 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[35] = {
-		.vic = 35,
-		.h_active = 2880,
-		.v_active = 480,
+	{
+		.vic = 113,
+		.h_active = 2560,
+		.v_active = 1080,
 		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 64,
-		.h_sync = 248,
-		.h_back = 240,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
+		.pixel_clock_hz = 198000000,
+		.h_front = 998,
+		.h_sync = 44,
+		.h_back = 148,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 4,
+		.v_sync = 5,
+		.v_back = 11,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[36] = {
-		.vic = 36,
-		.h_active = 2880,
-		.v_active = 480,
+	{
+		.vic = 114,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 64,
-		.h_sync = 248,
-		.h_back = 240,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
+		.pixel_clock_hz = 594000000,
+		.h_front = 1276,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[83] = {
-		.vic = 83,
-		.h_active = 1680,
-		.v_active = 720,
+	{
+		.vic = 115,
+		.h_active = 4096,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 99000000,
-		.h_front = 260,
-		.h_sync = 40,
-		.h_back = 220,
+		.pixel_clock_hz = 594000000,
+		.h_front = 1020,
+		.h_sync = 88,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+	},
+	{
+		.vic = 116,
+		.h_active = 3840,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 594000000,
+		.h_front = 1276,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[90] = {
-		.vic = 90,
-		.h_active = 2560,
-		.v_active = 1080,
+	{
+		.vic = 117,
+		.h_active = 3840,
+		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 198000000,
-		.h_front = 248,
-		.h_sync = 44,
-		.h_back = 148,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 1056,
+		.h_sync = 88,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 11,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 118,
+		.h_active = 3840,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 176,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+	},
+	{
+		.vic = 119,
+		.h_active = 3840,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 1056,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[97] = {
-		.vic = 97,
+	{
+		.vic = 120,
 		.h_active = 3840,
 		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 594000000,
+		.pixel_clock_hz = 1188000000,
 		.h_front = 176,
 		.h_sync = 88,
 		.h_back = 296,
@@ -1665,17 +1921,97 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 10,
 		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	},
+	{
+		.vic = 121,
+		.h_active = 5120,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 396000000,
+		.h_front = 1996,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 22,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	},
+	{
+		.vic = 122,
+		.h_active = 5120,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 396000000,
+		.h_front = 1696,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 22,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	},
+	{
+		.vic = 123,
+		.h_active = 5120,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 396000000,
+		.h_front = 664,
+		.h_sync = 88,
+		.h_back = 128,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 22,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	},
+	{
+		.vic = 124,
+		.h_active = 5120,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 742500000,
+		.h_front = 746,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 297,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+	},
+	{
+		.vic = 125,
+		.h_active = 5120,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 742500000,
+		.h_front = 1096,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[107] = {
-		.vic = 107,
-		.h_active = 3840,
+	{
+		.vic = 126,
+		.h_active = 5120,
 		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 594000000,
-		.h_front = 176,
+		.pixel_clock_hz = 742500000,
+		.h_front = 164,
 		.h_sync = 88,
-		.h_back = 296,
+		.h_back = 128,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 8,
 		.v_sync = 10,
@@ -1683,28 +2019,28 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[102] = {
-		.vic = 102,
-		.h_active = 4096,
+	{
+		.vic = 127,
+		.h_active = 5120,
 		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 594000000,
-		.h_front = 88,
+		.pixel_clock_hz = 1485000000,
+		.h_front = 1096,
 		.h_sync = 88,
-		.h_back = 128,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 8,
 		.v_sync = 10,
 		.v_back = 72,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[126] = {
-		.vic = 126,
+	{
+		.vic = 193,
 		.h_active = 5120,
 		.v_active = 2160,
 		.interlaced = false,
-		.pixel_clock_hz = 742500000,
+		.pixel_clock_hz = 1485000000,
 		.h_front = 164,
 		.h_sync = 88,
 		.h_back = 128,
@@ -1715,29 +2051,29 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[199] = {
-		.vic = 199,
+	{
+		.vic = 194,
 		.h_active = 7680,
 		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 2376000000,
-		.h_front = 552,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 2552,
 		.h_sync = 176,
 		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 16,
 		.v_sync = 20,
-		.v_back = 44,
+		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[207] = {
-		.vic = 207,
+	{
+		.vic = 195,
 		.h_active = 7680,
 		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 2376000000,
-		.h_front = 552,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 2352,
 		.h_sync = 176,
 		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -1745,249 +2081,73 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 20,
 		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[215] = {
-		.vic = 215,
-		.h_active = 10240,
+	{
+		.vic = 196,
+		.h_active = 7680,
 		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 2970000000,
-		.h_front = 288,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 552,
 		.h_sync = 176,
-		.h_back = 296,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 16,
 		.v_sync = 20,
-		.v_back = 144,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[40] = {
-		.vic = 40,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = true,
-		.pixel_clock_hz = 148500000,
-		.h_front = 528,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 2,
-		.v_sync = 5,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[41] = {
-		.vic = 41,
-		.h_active = 1280,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 440,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[70] = {
-		.vic = 70,
-		.h_active = 1280,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 440,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[42] = {
-		.vic = 42,
-		.h_active = 720,
-		.v_active = 576,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 12,
-		.h_sync = 64,
-		.h_back = 68,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[43] = {
-		.vic = 43,
-		.h_active = 720,
-		.v_active = 576,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 12,
-		.h_sync = 64,
-		.h_back = 68,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[44] = {
-		.vic = 44,
-		.h_active = 1440,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[45] = {
-		.vic = 45,
-		.h_active = 1440,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[64] = {
-		.vic = 64,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 528,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[77] = {
-		.vic = 77,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 528,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[84] = {
-		.vic = 84,
-		.h_active = 1680,
-		.v_active = 720,
-		.interlaced = false,
-		.pixel_clock_hz = 165000000,
-		.h_front = 60,
-		.h_sync = 40,
-		.h_back = 220,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 95,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[91] = {
-		.vic = 91,
-		.h_active = 2560,
-		.v_active = 1080,
-		.interlaced = false,
-		.pixel_clock_hz = 371250000,
-		.h_front = 218,
-		.h_sync = 44,
-		.h_back = 148,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 161,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
-	},
-	[117] = {
-		.vic = 117,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 197,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 1056,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 2376000000,
+		.h_front = 2552,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[119] = {
-		.vic = 119,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 198,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 1056,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 2376000000,
+		.h_front = 2352,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[127] = {
-		.vic = 127,
-		.h_active = 5120,
-		.v_active = 2160,
+	{
+		.vic = 199,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 1485000000,
-		.h_front = 1096,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 2376000000,
+		.h_front = 552,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[200] = {
+	{
 		.vic = 200,
 		.h_active = 7680,
 		.v_active = 4320,
@@ -2003,13 +2163,13 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[208] = {
-		.vic = 208,
+	{
+		.vic = 201,
 		.h_active = 7680,
 		.v_active = 4320,
 		.interlaced = false,
 		.pixel_clock_hz = 4752000000,
-		.h_front = 2112,
+		.h_front = 352,
 		.h_sync = 176,
 		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -2017,15 +2177,15 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync = 20,
 		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
 	},
-	[216] = {
-		.vic = 216,
-		.h_active = 10240,
+	{
+		.vic = 202,
+		.h_active = 7680,
 		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 5940000000,
-		.h_front = 2192,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 2552,
 		.h_sync = 176,
 		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -2035,269 +2195,221 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[218] = {
-		.vic = 218,
-		.h_active = 4096,
-		.v_active = 2160,
+	{
+		.vic = 203,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
 		.pixel_clock_hz = 1188000000,
-		.h_front = 800,
-		.h_sync = 88,
-		.h_back = 296,
+		.h_front = 2352,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[46] = {
-		.vic = 46,
-		.h_active = 1920,
-		.v_active = 1080,
-		.interlaced = true,
-		.pixel_clock_hz = 148500000,
-		.h_front = 88,
-		.h_sync = 44,
-		.h_back = 148,
+	{
+		.vic = 204,
+		.h_active = 7680,
+		.v_active = 4320,
+		.interlaced = false,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 552,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 2,
-		.v_sync = 5,
-		.v_back = 15,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[47] = {
-		.vic = 47,
-		.h_active = 1280,
-		.v_active = 720,
+	{
+		.vic = 205,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 110,
-		.h_sync = 40,
-		.h_back = 220,
+		.pixel_clock_hz = 2376000000,
+		.h_front = 2552,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[71] = {
-		.vic = 71,
-		.h_active = 1280,
-		.v_active = 720,
+	{
+		.vic = 206,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 148500000,
-		.h_front = 110,
-		.h_sync = 40,
-		.h_back = 220,
+		.pixel_clock_hz = 2376000000,
+		.h_front = 2352,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 20,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[48] = {
-		.vic = 48,
-		.h_active = 720,
-		.v_active = 480,
-		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 16,
-		.h_sync = 62,
-		.h_back = 60,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[49] = {
-		.vic = 49,
-		.h_active = 720,
-		.v_active = 480,
+	{
+		.vic = 207,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 54000000,
-		.h_front = 16,
-		.h_sync = 62,
-		.h_back = 60,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[50] = {
-		.vic = 50,
-		.h_active = 1440,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[51] = {
-		.vic = 51,
-		.h_active = 1440,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 54000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.pixel_clock_hz = 2376000000,
+		.h_front = 552,
+		.h_sync = 176,
+		.h_back = 592,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[63] = {
-		.vic = 63,
-		.h_active = 1920,
-		.v_active = 1080,
+	{
+		.vic = 208,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 88,
-		.h_sync = 44,
-		.h_back = 148,
+		.pixel_clock_hz = 4752000000,
+		.h_front = 2112,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[78] = {
-		.vic = 78,
-		.h_active = 1920,
-		.v_active = 1080,
+	{
+		.vic = 209,
+		.h_active = 7680,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 297000000,
-		.h_front = 88,
-		.h_sync = 44,
-		.h_back = 148,
+		.pixel_clock_hz = 4752000000,
+		.h_front = 352,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 36,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[85] = {
-		.vic = 85,
-		.h_active = 1680,
-		.v_active = 720,
+	{
+		.vic = 210,
+		.h_active = 10240,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 198000000,
-		.h_front = 60,
-		.h_sync = 40,
-		.h_back = 220,
+		.pixel_clock_hz = 1485000000,
+		.h_front = 1492,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 95,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 594,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[92] = {
-		.vic = 92,
-		.h_active = 2560,
-		.v_active = 1080,
+	{
+		.vic = 211,
+		.h_active = 10240,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 495000000,
-		.h_front = 548,
-		.h_sync = 44,
-		.h_back = 148,
+		.pixel_clock_hz = 1485000000,
+		.h_front = 2492,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 4,
-		.v_sync = 5,
-		.v_back = 161,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[118] = {
-		.vic = 118,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 212,
+		.h_active = 10240,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 176,
-		.h_sync = 88,
+		.pixel_clock_hz = 1485000000,
+		.h_front = 288,
+		.h_sync = 176,
 		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[120] = {
-		.vic = 120,
-		.h_active = 3840,
-		.v_active = 2160,
+	{
+		.vic = 213,
+		.h_active = 10240,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 1188000000,
-		.h_front = 176,
-		.h_sync = 88,
-		.h_back = 296,
+		.pixel_clock_hz = 2970000000,
+		.h_front = 1492,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 594,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[193] = {
-		.vic = 193,
-		.h_active = 5120,
-		.v_active = 2160,
+	{
+		.vic = 214,
+		.h_active = 10240,
+		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 1485000000,
-		.h_front = 164,
-		.h_sync = 88,
-		.h_back = 128,
+		.pixel_clock_hz = 2970000000,
+		.h_front = 2492,
+		.h_sync = 176,
+		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.v_front = 8,
-		.v_sync = 10,
-		.v_back = 72,
+		.v_front = 16,
+		.v_sync = 20,
+		.v_back = 44,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[201] = {
-		.vic = 201,
-		.h_active = 7680,
+	{
+		.vic = 215,
+		.h_active = 10240,
 		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 4752000000,
-		.h_front = 352,
+		.pixel_clock_hz = 2970000000,
+		.h_front = 288,
 		.h_sync = 176,
-		.h_back = 592,
+		.h_back = 296,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.v_front = 16,
 		.v_sync = 20,
 		.v_back = 144,
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[209] = {
-		.vic = 209,
-		.h_active = 7680,
+	{
+		.vic = 216,
+		.h_active = 10240,
 		.v_active = 4320,
 		.interlaced = false,
-		.pixel_clock_hz = 4752000000,
-		.h_front = 352,
+		.pixel_clock_hz = 5940000000,
+		.h_front = 2192,
 		.h_sync = 176,
 		.h_back = 592,
 		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
@@ -2307,7 +2419,7 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[217] = {
+	{
 		.vic = 217,
 		.h_active = 10240,
 		.v_active = 4320,
@@ -2323,7 +2435,23 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_64_27,
 	},
-	[219] = {
+	{
+		.vic = 218,
+		.h_active = 4096,
+		.v_active = 2160,
+		.interlaced = false,
+		.pixel_clock_hz = 1188000000,
+		.h_front = 800,
+		.h_sync = 88,
+		.h_back = 296,
+		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.v_front = 8,
+		.v_sync = 10,
+		.v_back = 72,
+		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
+		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
+	},
+	{
 		.vic = 219,
 		.h_active = 4096,
 		.v_active = 2160,
@@ -2339,134 +2467,954 @@ const struct di_cta_video_format _di_cta_video_formats[] = {
 		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE,
 		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_256_135,
 	},
-	[52] = {
-		.vic = 52,
-		.h_active = 720,
-		.v_active = 576,
-		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 12,
-		.h_sync = 64,
-		.h_back = 68,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[53] = {
-		.vic = 53,
-		.h_active = 720,
-		.v_active = 576,
-		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 12,
-		.h_sync = 64,
-		.h_back = 68,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 5,
-		.v_sync = 5,
-		.v_back = 39,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[54] = {
-		.vic = 54,
-		.h_active = 1440,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 108000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[55] = {
-		.vic = 55,
-		.h_active = 1440,
-		.v_active = 576,
-		.interlaced = true,
-		.pixel_clock_hz = 108000000,
-		.h_front = 24,
-		.h_sync = 126,
-		.h_back = 138,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 2,
-		.v_sync = 3,
-		.v_back = 19,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[56] = {
-		.vic = 56,
-		.h_active = 720,
-		.v_active = 480,
-		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 16,
-		.h_sync = 62,
-		.h_back = 60,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[57] = {
-		.vic = 57,
-		.h_active = 720,
-		.v_active = 480,
-		.interlaced = false,
-		.pixel_clock_hz = 108000000,
-		.h_front = 16,
-		.h_sync = 62,
-		.h_back = 60,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 9,
-		.v_sync = 6,
-		.v_back = 30,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
-	[58] = {
-		.vic = 58,
-		.h_active = 1440,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 108000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_4_3,
-	},
-	[59] = {
-		.vic = 59,
-		.h_active = 1440,
-		.v_active = 480,
-		.interlaced = true,
-		.pixel_clock_hz = 108000000,
-		.h_front = 38,
-		.h_sync = 124,
-		.h_back = 114,
-		.h_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.v_front = 4,
-		.v_sync = 3,
-		.v_back = 15,
-		.v_sync_polarity = DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE,
-		.picture_aspect_ratio = DI_CTA_VIDEO_FORMAT_PICTURE_ASPECT_RATIO_16_9,
-	},
 };
 
-const size_t _di_cta_video_formats_len = 220;
+const size_t _di_cta_video_formats_len = 154;
+
+const uint8_t _di_cta_video_formats_by_vic[256] = {
+	[1] = 1,
+	[2] = 2,
+	[3] = 3,
+	[4] = 4,
+	[5] = 5,
+	[6] = 6,
+	[7] = 7,
+	[8] = 8,
+	[9] = 9,
+	[10] = 10,
+	[11] = 11,
+	[12] = 12,
+	[13] = 13,
+	[14] = 14,
+	[15] = 15,
+	[16] = 16,
+	[17] = 17,
+	[18] = 18,
+	[19] = 19,
+	[20] = 20,
+	[21] = 21,
+	[22] = 22,
+	[23] = 23,
+	[24] = 24,
+	[25] = 25,
+	[26] = 26,
+	[27] = 27,
+	[28] = 28,
+	[29] = 29,
+	[30] = 30,
+	[31] = 31,
+	[32] = 32,
+	[33] = 33,
+	[34] = 34,
+	[35] = 35,
+	[36] = 36,
+	[37] = 37,
+	[38] = 38,
+	[39] = 39,
+	[40] = 40,
+	[41] = 41,
+	[42] = 42,
+	[43] = 43,
+	[44] = 44,
+	[45] = 45,
+	[46] = 46,
+	[47] = 47,
+	[48] = 48,
+	[49] = 49,
+	[50] = 50,
+	[51] = 51,
+	[52] = 52,
+	[53] = 53,
+	[54] = 54,
+	[55] = 55,
+	[56] = 56,
+	[57] = 57,
+	[58] = 58,
+	[59] = 59,
+	[60] = 60,
+	[61] = 61,
+	[62] = 62,
+	[63] = 63,
+	[64] = 64,
+	[65] = 65,
+	[66] = 66,
+	[67] = 67,
+	[68] = 68,
+	[69] = 69,
+	[70] = 70,
+	[71] = 71,
+	[72] = 72,
+	[73] = 73,
+	[74] = 74,
+	[75] = 75,
+	[76] = 76,
+	[77] = 77,
+	[78] = 78,
+	[79] = 79,
+	[80] = 80,
+	[81] = 81,
+	[82] = 82,
+	[83] = 83,
+	[84] = 84,
+	[85] = 85,
+	[86] = 86,
+	[87] = 87,
+	[88] = 88,
+	[89] = 89,
+	[90] = 90,
+	[91] = 91,
+	[92] = 92,
+	[93] = 93,
+	[94] = 94,
+	[95] = 95,
+	[96] = 96,
+	[97] = 97,
+	[98] = 98,
+	[99] = 99,
+	[100] = 100,
+	[101] = 101,
+	[102] = 102,
+	[103] = 103,
+	[104] = 104,
+	[105] = 105,
+	[106] = 106,
+	[107] = 107,
+	[108] = 108,
+	[109] = 109,
+	[110] = 110,
+	[111] = 111,
+	[112] = 112,
+	[113] = 113,
+	[114] = 114,
+	[115] = 115,
+	[116] = 116,
+	[117] = 117,
+	[118] = 118,
+	[119] = 119,
+	[120] = 120,
+	[121] = 121,
+	[122] = 122,
+	[123] = 123,
+	[124] = 124,
+	[125] = 125,
+	[126] = 126,
+	[127] = 127,
+	[193] = 128,
+	[194] = 129,
+	[195] = 130,
+	[196] = 131,
+	[197] = 132,
+	[198] = 133,
+	[199] = 134,
+	[200] = 135,
+	[201] = 136,
+	[202] = 137,
+	[203] = 138,
+	[204] = 139,
+	[205] = 140,
+	[206] = 141,
+	[207] = 142,
+	[208] = 143,
+	[209] = 144,
+	[210] = 145,
+	[211] = 146,
+	[212] = 147,
+	[213] = 148,
+	[214] = 149,
+	[215] = 150,
+	[216] = 151,
+	[217] = 152,
+	[218] = 153,
+	[219] = 154,
+};
+
+const uint16_t _di_cta_video_formats_h_active[] = {
+	640,
+	720,
+	720,
+	1280,
+	1920,
+	1440,
+	1440,
+	1440,
+	1440,
+	2880,
+	2880,
+	2880,
+	2880,
+	1440,
+	1440,
+	1920,
+	720,
+	720,
+	1280,
+	1920,
+	1440,
+	1440,
+	1440,
+	1440,
+	2880,
+	2880,
+	2880,
+	2880,
+	1440,
+	1440,
+	1920,
+	1920,
+	1920,
+	1920,
+	2880,
+	2880,
+	2880,
+	2880,
+	1920,
+	1920,
+	1280,
+	720,
+	720,
+	1440,
+	1440,
+	1920,
+	1280,
+	720,
+	720,
+	1440,
+	1440,
+	720,
+	720,
+	1440,
+	1440,
+	720,
+	720,
+	1440,
+	1440,
+	1280,
+	1280,
+	1280,
+	1920,
+	1920,
+	1280,
+	1280,
+	1280,
+	1280,
+	1280,
+	1280,
+	1280,
+	1920,
+	1920,
+	1920,
+	1920,
+	1920,
+	1920,
+	1920,
+	1680,
+	1680,
+	1680,
+	1680,
+	1680,
+	1680,
+	1680,
+	2560,
+	2560,
+	2560,
+	2560,
+	2560,
+	2560,
+	2560,
+	3840,
+	3840,
+	3840,
+	3840,
+	3840,
+	4096,
+	4096,
+	4096,
+	4096,
+	4096,
+	3840,
+	3840,
+	3840,
+	3840,
+	3840,
+	1280,
+	1280,
+	1680,
+	1920,
+	1920,
+	2560,
+	3840,
+	4096,
+	3840,
+	3840,
+	3840,
+	3840,
+	3840,
+	5120,
+	5120,
+	5120,
+	5120,
+	5120,
+	5120,
+	5120,
+	5120,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	7680,
+	10240,
+	10240,
+	10240,
+	10240,
+	10240,
+	10240,
+	10240,
+	10240,
+	4096,
+	4096,
+};
+
+const uint16_t _di_cta_video_formats_v_active[] = {
+	480,
+	480,
+	480,
+	720,
+	1080,
+	480,
+	480,
+	240,
+	240,
+	480,
+	480,
+	240,
+	240,
+	480,
+	480,
+	1080,
+	576,
+	576,
+	720,
+	1080,
+	576,
+	576,
+	288,
+	288,
+	576,
+	576,
+	288,
+	288,
+	576,
+	576,
+	1080,
+	1080,
+	1080,
+	1080,
+	480,
+	480,
+	576,
+	576,
+	1080,
+	1080,
+	720,
+	576,
+	576,
+	576,
+	576,
+	1080,
+	720,
+	480,
+	480,
+	480,
+	480,
+	576,
+	576,
+	576,
+	576,
+	480,
+	480,
+	480,
+	480,
+	720,
+	720,
+	720,
+	1080,
+	1080,
+	720,
+	720,
+	720,
+	720,
+	720,
+	720,
+	720,
+	1080,
+	1080,
+	1080,
+	1080,
+	1080,
+	1080,
+	1080,
+	720,
+	720,
+	720,
+	720,
+	720,
+	720,
+	720,
+	1080,
+	1080,
+	1080,
+	1080,
+	1080,
+	1080,
+	1080,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	720,
+	720,
+	720,
+	1080,
+	1080,
+	1080,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	2160,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	4320,
+	2160,
+	2160,
+};
+
+const uint32_t _di_cta_video_formats_pixel_clock_khz[] = {
+	25175,
+	27000,
+	27000,
+	74250,
+	74250,
+	27000,
+	27000,
+	27000,
+	27000,
+	54000,
+	54000,
+	54000,
+	54000,
+	54000,
+	54000,
+	148500,
+	27000,
+	27000,
+	74250,
+	74250,
+	27000,
+	27000,
+	27000,
+	27000,
+	54000,
+	54000,
+	54000,
+	54000,
+	54000,
+	54000,
+	148500,
+	74250,
+	74250,
+	74250,
+	108000,
+	108000,
+	108000,
+	108000,
+	72000,
+	148500,
+	148500,
+	54000,
+	54000,
+	54000,
+	54000,
+	148500,
+	148500,
+	54000,
+	54000,
+	54000,
+	54000,
+	108000,
+	108000,
+	108000,
+	108000,
+	108000,
+	108000,
+	108000,
+	108000,
+	59400,
+	74250,
+	74250,
+	297000,
+	297000,
+	59400,
+	74250,
+	74250,
+	74250,
+	74250,
+	148500,
+	148500,
+	74250,
+	74250,
+	74250,
+	148500,
+	148500,
+	297000,
+	297000,
+	59400,
+	59400,
+	59400,
+	82500,
+	99000,
+	165000,
+	198000,
+	99000,
+	90000,
+	118800,
+	185625,
+	198000,
+	371250,
+	495000,
+	297000,
+	297000,
+	297000,
+	594000,
+	594000,
+	297000,
+	297000,
+	297000,
+	594000,
+	594000,
+	297000,
+	297000,
+	297000,
+	594000,
+	594000,
+	90000,
+	90000,
+	99000,
+	148500,
+	148500,
+	198000,
+	594000,
+	594000,
+	594000,
+	1188000,
+	1188000,
+	1188000,
+	1188000,
+	396000,
+	396000,
+	396000,
+	742500,
+	742500,
+	742500,
+	1485000,
+	1485000,
+	1188000,
+	1188000,
+	1188000,
+	2376000,
+	2376000,
+	2376000,
+	4752000,
+	4752000,
+	1188000,
+	1188000,
+	1188000,
+	2376000,
+	2376000,
+	2376000,
+	4752000,
+	4752000,
+	1485000,
+	1485000,
+	1485000,
+	2970000,
+	2970000,
+	2970000,
+	5940000,
+	5940000,
+	1188000,
+	1188000,
+};
+
+const uint8_t _di_cta_video_formats_by_res[] = {
+	0, /* VIC 1: 640x480 */
+	1, /* VIC 2: 720x480 */
+	2, /* VIC 3: 720x480 */
+	47, /* VIC 48: 720x480 */
+	48, /* VIC 49: 720x480 */
+	55, /* VIC 56: 720x480 */
+	56, /* VIC 57: 720x480 */
+	16, /* VIC 17: 720x576 */
+	17, /* VIC 18: 720x576 */
+	41, /* VIC 42: 720x576 */
+	42, /* VIC 43: 720x576 */
+	51, /* VIC 52: 720x576 */
+	52, /* VIC 53: 720x576 */
+	3, /* VIC 4: 1280x720 */
+	18, /* VIC 19: 1280x720 */
+	40, /* VIC 41: 1280x720 */
+	46, /* VIC 47: 1280x720 */
+	59, /* VIC 60: 1280x720 */
+	60, /* VIC 61: 1280x720 */
+	61, /* VIC 62: 1280x720 */
+	64, /* VIC 65: 1280x720 */
+	65, /* VIC 66: 1280x720 */
+	66, /* VIC 67: 1280x720 */
+	67, /* VIC 68: 1280x720 */
+	68, /* VIC 69: 1280x720 */
+	69, /* VIC 70: 1280x720 */
+	70, /* VIC 71: 1280x720 */
+	107, /* VIC 108: 1280x720 */
+	108, /* VIC 109: 1280x720 */
+	7, /* VIC 8: 1440x240 */
+	8, /* VIC 9: 1440x240 */
+	22, /* VIC 23: 1440x288 */
+	23, /* VIC 24: 1440x288 */
+	5, /* VIC 6: 1440x480 */
+	6, /* VIC 7: 1440x480 */
+	13, /* VIC 14: 1440x480 */
+	14, /* VIC 15: 1440x480 */
+	49, /* VIC 50: 1440x480 */
+	50, /* VIC 51: 1440x480 */
+	57, /* VIC 58: 1440x480 */
+	58, /* VIC 59: 1440x480 */
+	20, /* VIC 21: 1440x576 */
+	21, /* VIC 22: 1440x576 */
+	28, /* VIC 29: 1440x576 */
+	29, /* VIC 30: 1440x576 */
+	43, /* VIC 44: 1440x576 */
+	44, /* VIC 45: 1440x576 */
+	53, /* VIC 54: 1440x576 */
+	54, /* VIC 55: 1440x576 */
+	78, /* VIC 79: 1680x720 */
+	79, /* VIC 80: 1680x720 */
+	80, /* VIC 81: 1680x720 */
+	81, /* VIC 82: 1680x720 */
+	82, /* VIC 83: 1680x720 */
+	83, /* VIC 84: 1680x720 */
+	84, /* VIC 85: 1680x720 */
+	109, /* VIC 110: 1680x720 */
+	4, /* VIC 5: 1920x1080 */
+	15, /* VIC 16: 1920x1080 */
+	19, /* VIC 20: 1920x1080 */
+	30, /* VIC 31: 1920x1080 */
+	31, /* VIC 32: 1920x1080 */
+	32, /* VIC 33: 1920x1080 */
+	33, /* VIC 34: 1920x1080 */
+	38, /* VIC 39: 1920x1080 */
+	39, /* VIC 40: 1920x1080 */
+	45, /* VIC 46: 1920x1080 */
+	62, /* VIC 63: 1920x1080 */
+	63, /* VIC 64: 1920x1080 */
+	71, /* VIC 72: 1920x1080 */
+	72, /* VIC 73: 1920x1080 */
+	73, /* VIC 74: 1920x1080 */
+	74, /* VIC 75: 1920x1080 */
+	75, /* VIC 76: 1920x1080 */
+	76, /* VIC 77: 1920x1080 */
+	77, /* VIC 78: 1920x1080 */
+	110, /* VIC 111: 1920x1080 */
+	111, /* VIC 112: 1920x1080 */
+	85, /* VIC 86: 2560x1080 */
+	86, /* VIC 87: 2560x1080 */
+	87, /* VIC 88: 2560x1080 */
+	88, /* VIC 89: 2560x1080 */
+	89, /* VIC 90: 2560x1080 */
+	90, /* VIC 91: 2560x1080 */
+	91, /* VIC 92: 2560x1080 */
+	112, /* VIC 113: 2560x1080 */
+	11, /* VIC 12: 2880x240 */
+	12, /* VIC 13: 2880x240 */
+	26, /* VIC 27: 2880x288 */
+	27, /* VIC 28: 2880x288 */
+	9, /* VIC 10: 2880x480 */
+	10, /* VIC 11: 2880x480 */
+	34, /* VIC 35: 2880x480 */
+	35, /* VIC 36: 2880x480 */
+	24, /* VIC 25: 2880x576 */
+	25, /* VIC 26: 2880x576 */
+	36, /* VIC 37: 2880x576 */
+	37, /* VIC 38: 2880x576 */
+	92, /* VIC 93: 3840x2160 */
+	93, /* VIC 94: 3840x2160 */
+	94, /* VIC 95: 3840x2160 */
+	95, /* VIC 96: 3840x2160 */
+	96, /* VIC 97: 3840x2160 */
+	102, /* VIC 103: 3840x2160 */
+	103, /* VIC 104: 3840x2160 */
+	104, /* VIC 105: 3840x2160 */
+	105, /* VIC 106: 3840x2160 */
+	106, /* VIC 107: 3840x2160 */
+	113, /* VIC 114: 3840x2160 */
+	115, /* VIC 116: 3840x2160 */
+	116, /* VIC 117: 3840x2160 */
+	117, /* VIC 118: 3840x2160 */
+	118, /* VIC 119: 3840x2160 */
+	119, /* VIC 120: 3840x2160 */
+	97, /* VIC 98: 4096x2160 */
+	98, /* VIC 99: 4096x2160 */
+	99, /* VIC 100: 4096x2160 */
+	100, /* VIC 101: 4096x2160 */
+	101, /* VIC 102: 4096x2160 */
+	114, /* VIC 115: 4096x2160 */
+	152, /* VIC 218: 4096x2160 */
+	153, /* VIC 219: 4096x2160 */
+	120, /* VIC 121: 5120x2160 */
+	121, /* VIC 122: 5120x2160 */
+	122, /* VIC 123: 5120x2160 */
+	123, /* VIC 124: 5120x2160 */
+	124, /* VIC 125: 5120x2160 */
+	125, /* VIC 126: 5120x2160 */
+	126, /* VIC 127: 5120x2160 */
+	127, /* VIC 193: 5120x2160 */
+	128, /* VIC 194: 7680x4320 */
+	129, /* VIC 195: 7680x4320 */
+	130, /* VIC 196: 7680x4320 */
+	131, /* VIC 197: 7680x4320 */
+	132, /* VIC 198: 7680x4320 */
+	133, /* VIC 199: 7680x4320 */
+	134, /* VIC 200: 7680x4320 */
+	135, /* VIC 201: 7680x4320 */
+	136, /* VIC 202: 7680x4320 */
+	137, /* VIC 203: 7680x4320 */
+	138, /* VIC 204: 7680x4320 */
+	139, /* VIC 205: 7680x4320 */
+	140, /* VIC 206: 7680x4320 */
+	141, /* VIC 207: 7680x4320 */
+	142, /* VIC 208: 7680x4320 */
+	143, /* VIC 209: 7680x4320 */
+	144, /* VIC 210: 10240x4320 */
+	145, /* VIC 211: 10240x4320 */
+	146, /* VIC 212: 10240x4320 */
+	147, /* VIC 213: 10240x4320 */
+	148, /* VIC 214: 10240x4320 */
+	149, /* VIC 215: 10240x4320 */
+	150, /* VIC 216: 10240x4320 */
+	151, /* VIC 217: 10240x4320 */
+};
+
+const uint8_t _di_cta_video_formats_dmt_id[] = {
+	0x04, /* VIC 1 */
+	0,
+	0,
+	0x55, /* VIC 4 */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0x52, /* VIC 16 */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0x55, /* VIC 69 */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0x52, /* VIC 76 */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+};
+
+const uint8_t _di_cta_vic_by_dmt_id[256] = {
+	[0x04] = 1,
+	[0x52] = 16,
+	[0x55] = 4,
+};
@@ -10,6 +10,7 @@
 #include "log.h"
 #include "edid.h"
 #include "displayid.h"
+#include "dmt.h"
 
 /**
  * Number of bytes in the CTA header (tag + revision + DTD offset + flags).
@@ -31,10 +32,96 @@
 const struct di_cta_video_format *
 di_cta_video_format_from_vic(uint8_t vic)
 {
-	if (vic > _di_cta_video_formats_len ||
-	    _di_cta_video_formats[vic].vic == 0)
+	uint8_t index = _di_cta_video_formats_by_vic[vic];
+
+	if (index == 0)
+		return NULL;
+	return &_di_cta_video_formats[index - 1];
+}
+
+const struct di_cta_video_format *
+di_cta_video_formats_iter(size_t *index)
+{
+	if (*index >= _di_cta_video_formats_len)
+		return NULL;
+	return &_di_cta_video_formats[(*index)++];
+}
+
+const struct di_dmt_timing *
+di_cta_video_format_get_dmt(const struct di_cta_video_format *fmt)
+{
+	size_t index = (size_t) (fmt - _di_cta_video_formats);
+
+	assert(index < _di_cta_video_formats_len);
+	if (_di_cta_video_formats_dmt_id[index] == 0)
 		return NULL;
-	return &_di_cta_video_formats[vic];
+	return di_dmt_find_by_id(_di_cta_video_formats_dmt_id[index]);
+}
+
+/**
+ * Maximum difference between a requested and a video format refresh rate.
+ */
+#define VIDEO_FORMAT_REFRESH_RATE_TOLERANCE_HZ 0.5
+
+static double
+video_format_refresh_rate(const struct di_cta_video_format *fmt)
+{
+	int32_t v_active;
+	double h_total, v_total;
+
+	v_active = fmt->v_active;
+	if (fmt->interlaced)
+		v_active /= 2;
+
+	h_total = fmt->h_active + fmt->h_front + fmt->h_sync + fmt->h_back;
+	v_total = v_active + fmt->v_front + fmt->v_sync + fmt->v_back;
+	if (fmt->interlaced)
+		v_total += 0.5;
+
+	return (double) fmt->pixel_clock_hz / (h_total * v_total);
+}
+
+const struct di_cta_video_format *
+di_cta_video_format_find(int32_t h_active, int32_t v_active,
+			 float refresh_rate_hz, bool interlaced,
+			 enum di_cta_video_format_picture_aspect_ratio picture_aspect_ratio)
+{
+	size_t lo, hi, mid, i;
+	const struct di_cta_video_format *fmt, *best = NULL;
+	double diff, best_diff = 0;
+
+	/* Lower bound of the resolution in the sorted index */
+	lo = 0;
+	hi = _di_cta_video_formats_len;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		i = _di_cta_video_formats_by_res[mid];
+		if (_di_cta_video_formats_h_active[i] < h_active ||
+		    (_di_cta_video_formats_h_active[i] == h_active &&
+		     _di_cta_video_formats_v_active[i] < v_active))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for (; lo < _di_cta_video_formats_len; lo++) {
+		i = _di_cta_video_formats_by_res[lo];
+		if (_di_cta_video_formats_h_active[i] != h_active ||
+		    _di_cta_video_formats_v_active[i] != v_active)
+			break;
+		fmt = &_di_cta_video_formats[i];
+		if (fmt->interlaced != interlaced ||
+		    fmt->picture_aspect_ratio != picture_aspect_ratio)
+			continue;
+		diff = fabs(video_format_refresh_rate(fmt) - refresh_rate_hz);
+		if (diff <= VIDEO_FORMAT_REFRESH_RATE_TOLERANCE_HZ &&
+		    (!best || diff < best_diff)) {
+			best = fmt;
+			best_diff = diff;
+		}
+	}
+
+	return best;
 }
 
 static void
@@ -84,6 +171,8 @@ parse_svd(struct di_edid_cta *cta, uint8_t raw, const char *prefix)
 		};
 	}
 
+	svd.video_format = di_cta_video_format_from_vic(svd.vic);
+
 	svd_ptr = calloc(1, sizeof(*svd_ptr));
 	if (!svd_ptr)
 		return NULL;
@@ -127,6 +216,8 @@ parse_ycbcr420_block(struct di_edid_cta *cta,
 		svd = parse_svd(cta, data[i], "YCbCr 4:2:0 Video Data Block");
 		if (!svd)
 			continue;
+		svd->ycbcr420 = true;
+		svd->ycbcr420_only = true;
 		assert(ycbcr420->svds_len < EDID_CTA_MAX_VIDEO_BLOCK_ENTRIES);
 		ycbcr420->svds[ycbcr420->svds_len++] = svd;
 	}
@@ -1128,6 +1219,7 @@ parse_video_format_pref_block(struct di_edid_cta *cta,
 		    (code >= 193 && code <= 253)) {
 			svr->type = DI_CTA_SVR_TYPE_VIC;
 			svr->vic = code;
+			svr->video_format = di_cta_video_format_from_vic(code);
 		} else if (code >= 129 && code <= 144) {
 			svr->type = DI_CTA_SVR_TYPE_DTD_INDEX;
 			svr->dtd_index = code - 129;
@@ -1500,7 +1592,7 @@ parse_speaker_location_block(struct di_edid_cta *cta,
 			     struct di_cta_speaker_location_block *sldb,
 			     const uint8_t *data, size_t size)
 {
-	struct di_cta_speaker_locations speaker_loc, *slp;
+	struct di_cta_speaker_locations *slp;
 
 	if (size < 2) {
 		add_failure(cta, "Speaker Location Data Block: Empty Data Block with length %u.",
@@ -1509,35 +1601,35 @@ parse_speaker_location_block(struct di_edid_cta *cta,
 	}
 
 	while (size >= 2) {
-		speaker_loc.has_coords = has_bit(data[0], 6);
-		speaker_loc.is_active = has_bit(data[0], 5);
-		speaker_loc.channel_index = get_bit_range(data[0], 4, 0);
-		speaker_loc.speaker_id = get_bit_range(data[1], 4, 0);
+		slp = calloc(1, sizeof(*slp));
+		if (!slp)
+			return false;
+
+		slp->has_coords = has_bit(data[0], 6);
+		slp->is_active = has_bit(data[0], 5);
+		slp->channel_index = get_bit_range(data[0], 4, 0);
+		slp->speaker_id = get_bit_range(data[1], 4, 0);
 
 		if (has_bit(data[0], 7) || get_bit_range(data[1], 7, 5) != 0) {
 			add_failure(cta, "Speaker Location Data Block: Bits F27-F25, F17 must be 0.");
 		}
 
-		if (speaker_loc.has_coords && size >= 5) {
-			speaker_loc.x = decode_coord(data[2]);
-			speaker_loc.y = decode_coord(data[3]);
-			speaker_loc.z = decode_coord(data[4]);
+		if (slp->has_coords && size >= 5) {
+			slp->x = decode_coord(data[2]);
+			slp->y = decode_coord(data[3]);
+			slp->z = decode_coord(data[4]);
 			size -= 5;
 			data += 5;
-		} else if (speaker_loc.has_coords) {
+		} else if (slp->has_coords) {
 			add_failure(cta, "Speaker Location Data Block: COORD bit "
 					 "set but contains no Coordinates.");
+			free(slp);
 			return false;
 		} else {
 			size -= 2;
 			data += 2;
 		}
 
-		slp = calloc(1, sizeof(*slp));
-		if (!slp)
-			return false;
-
-		*slp = speaker_loc;
 		assert(sldb->locations_len < EDID_CTA_MAX_SPEAKER_LOCATION_BLOCK_ENTRIES);
 		sldb->locations[sldb->locations_len++] = slp;
 	}
@@ -1646,6 +1738,37 @@ destroy_data_block(struct di_cta_data_block *data_block)
 	free(data_block);
 }
 
+static void
+add_unknown_svds(struct di_edid_cta *cta, struct di_cta_svd *const *svds)
+{
+	size_t i;
+
+	for (i = 0; svds[i]; i++) {
+		if (svds[i]->video_format)
+			continue;
+		assert(cta->unknown_svds_len < EDID_CTA_MAX_SVDS);
+		cta->unknown_svds[cta->unknown_svds_len++] = svds[i];
+	}
+}
+
+/**
+ * Parse the VRR fields of an HDMI Forum Sink Capability Data Structure, as
+ * carried by the HDMI Forum Vendor-Specific Data Block and the HDMI Forum Sink
+ * Capability Data Block. The other fields are not exposed yet.
+ */
+static void
+parse_hdmi_scds(struct di_edid_cta *cta, const uint8_t *data, size_t size)
+{
+	if (size < 7 || cta->hdmi_vrr_min_hz != 0)
+		return;
+
+	/* VRRmin zero means that VRR is not supported */
+	cta->hdmi_vrr_min_hz = get_bit_range(data[5], 5, 0);
+	if (cta->hdmi_vrr_min_hz == 0)
+		return;
+	cta->hdmi_vrr_max_hz = (get_bit_range(data[5], 7, 6) << 8) | data[6];
+}
+
 static bool
 parse_data_block(struct di_edid_cta *cta, uint8_t raw_tag, const uint8_t *data, size_t size)
 {
@@ -1670,7 +1793,10 @@ parse_data_block(struct di_edid_cta *cta, uint8_t raw_tag, const uint8_t *data,
 			goto error;
 		break;
 	case 3:
-		/* Vendor-Specific Data Block */
+		/* Vendor-Specific Data Block, OUI in little-endian */
+		if (size >= 3 && data[0] == 0xD8 && data[1] == 0x5D &&
+		    data[2] == 0xC4)
+			parse_hdmi_scds(cta, &data[3], size - 3);
 		goto skip;
 	case 4:
 		tag = DI_CTA_DATA_BLOCK_SPEAKER_ALLOC;
@@ -1802,6 +1928,9 @@ parse_data_block(struct di_edid_cta *cta, uint8_t raw_tag, const uint8_t *data,
 			break;
 		case 121:
 			tag = DI_CTA_DATA_BLOCK_HDMI_SINK_CAP;
+			/* Two reserved bytes precede the SCDS */
+			if (size >= 2)
+				parse_hdmi_scds(cta, &data[2], size - 2);
 			break;
 		case 1: /* Vendor-Specific Video Data Block */
 		case 17: /* Vendor-Specific Audio Data Block */
@@ -1824,6 +1953,12 @@ parse_data_block(struct di_edid_cta *cta, uint8_t raw_tag, const uint8_t *data,
 	data_block->tag = tag;
 	assert(cta->data_blocks_len < EDID_CTA_MAX_DATA_BLOCKS);
 	cta->data_blocks[cta->data_blocks_len++] = data_block;
+	if (!cta->data_blocks_by_tag[tag])
+		cta->data_blocks_by_tag[tag] = data_block;
+	if (tag == DI_CTA_DATA_BLOCK_VIDEO)
+		add_unknown_svds(cta, data_block->video.svds);
+	else if (tag == DI_CTA_DATA_BLOCK_YCBCR420)
+		add_unknown_svds(cta, data_block->ycbcr420.svds);
 	return true;
 
 skip:
@@ -1835,6 +1970,35 @@ error:
 	return false;
 }
 
+/**
+ * Apply the YCbCr 4:2:0 Capability Map Data Block to the SVDs of the regular
+ * Video Data Blocks.
+ */
+static void
+apply_ycbcr420_cap_map(struct di_edid_cta *cta)
+{
+	const struct di_cta_data_block *cap_map_block, *data_block;
+	struct di_cta_svd *svd;
+	size_t i, j, svd_index = 0;
+
+	cap_map_block = cta->data_blocks_by_tag[DI_CTA_DATA_BLOCK_YCBCR420_CAP_MAP];
+	if (!cap_map_block)
+		return;
+
+	for (i = 0; i < cta->data_blocks_len; i++) {
+		data_block = cta->data_blocks[i];
+		if (data_block->tag != DI_CTA_DATA_BLOCK_VIDEO)
+			continue;
+
+		for (j = 0; j < data_block->video.svds_len; j++) {
+			svd = data_block->video.svds[j];
+			svd->ycbcr420 = di_cta_ycbcr420_cap_map_supported(&cap_map_block->ycbcr420_cap_map,
+									  svd_index);
+			svd_index++;
+		}
+	}
+}
+
 bool
 _di_edid_cta_parse(struct di_edid_cta *cta, const uint8_t *data, size_t size,
 		   struct di_logger *logger)
@@ -1919,6 +2083,8 @@ _di_edid_cta_parse(struct di_edid_cta *cta, const uint8_t *data, size_t size,
 		i++;
 	}
 
+	apply_ycbcr420_cap_map(cta);
+
 	cta->logger = NULL;
 	return true;
 }
@@ -1937,6 +2103,369 @@ _di_edid_cta_finish(struct di_edid_cta *cta)
 	}
 }
 
+static bool
+svds_equal(struct di_cta_svd *const *a, struct di_cta_svd *const *b)
+{
+	size_t i;
+
+	for (i = 0; a[i] && b[i]; i++) {
+		if (a[i]->vic != b[i]->vic || a[i]->native != b[i]->native)
+			return false;
+	}
+
+	return !a[i] && !b[i];
+}
+
+static bool
+sad_equal(const struct di_cta_sad_priv *a, const struct di_cta_sad_priv *b)
+{
+	const struct di_cta_sad_sample_rates *rates_a = &a->supported_sample_rates;
+	const struct di_cta_sad_sample_rates *rates_b = &b->supported_sample_rates;
+
+	return a->base.format == b->base.format &&
+	       a->base.max_channels == b->base.max_channels &&
+	       a->base.max_bitrate_kbs == b->base.max_bitrate_kbs &&
+	       rates_a->has_192_khz == rates_b->has_192_khz &&
+	       rates_a->has_176_4_khz == rates_b->has_176_4_khz &&
+	       rates_a->has_96_khz == rates_b->has_96_khz &&
+	       rates_a->has_88_2_khz == rates_b->has_88_2_khz &&
+	       rates_a->has_48_khz == rates_b->has_48_khz &&
+	       rates_a->has_44_1_khz == rates_b->has_44_1_khz &&
+	       rates_a->has_32_khz == rates_b->has_32_khz &&
+	       a->lpcm.has_sample_size_24_bits == b->lpcm.has_sample_size_24_bits &&
+	       a->lpcm.has_sample_size_20_bits == b->lpcm.has_sample_size_20_bits &&
+	       a->lpcm.has_sample_size_16_bits == b->lpcm.has_sample_size_16_bits &&
+	       a->mpegh_3d.level == b->mpegh_3d.level &&
+	       a->mpegh_3d.low_complexity_profile == b->mpegh_3d.low_complexity_profile &&
+	       a->mpegh_3d.baseline_profile == b->mpegh_3d.baseline_profile &&
+	       a->mpeg_aac.has_frame_length_960 == b->mpeg_aac.has_frame_length_960 &&
+	       a->mpeg_aac.has_frame_length_1024 == b->mpeg_aac.has_frame_length_1024 &&
+	       a->mpeg_surround.signaling == b->mpeg_surround.signaling &&
+	       a->mpeg_aac_le.supports_multichannel_sound == b->mpeg_aac_le.supports_multichannel_sound &&
+	       a->enhanced_ac3.supports_joint_object_coding == b->enhanced_ac3.supports_joint_object_coding &&
+	       a->enhanced_ac3.supports_joint_object_coding_ACMOD28 == b->enhanced_ac3.supports_joint_object_coding_ACMOD28 &&
+	       a->mat.supports_object_audio_and_channel_based == b->mat.supports_object_audio_and_channel_based &&
+	       a->mat.requires_hash_calculation == b->mat.requires_hash_calculation &&
+	       a->wma_pro.profile == b->wma_pro.profile;
+}
+
+static bool
+sads_equal(struct di_cta_sad_priv *const *a, struct di_cta_sad_priv *const *b)
+{
+	size_t i;
+
+	for (i = 0; a[i] && b[i]; i++) {
+		if (!sad_equal(a[i], b[i]))
+			return false;
+	}
+
+	return !a[i] && !b[i];
+}
+
+static bool
+speaker_allocation_equal(const struct di_cta_speaker_allocation *a,
+			 const struct di_cta_speaker_allocation *b)
+{
+	return a->flw_frw == b->flw_frw &&
+	       a->flc_frc == b->flc_frc &&
+	       a->bc == b->bc &&
+	       a->bl_br == b->bl_br &&
+	       a->fc == b->fc &&
+	       a->lfe1 == b->lfe1 &&
+	       a->fl_fr == b->fl_fr &&
+	       a->tpsil_tpsir == b->tpsil_tpsir &&
+	       a->sil_sir == b->sil_sir &&
+	       a->tpbc == b->tpbc &&
+	       a->lfe2 == b->lfe2 &&
+	       a->ls_rs == b->ls_rs &&
+	       a->tpfc == b->tpfc &&
+	       a->tpc == b->tpc &&
+	       a->tpfl_tpfr == b->tpfl_tpfr &&
+	       a->btfl_btfr == b->btfl_btfr &&
+	       a->btfc == b->btfc &&
+	       a->tpbl_tpbr == b->tpbl_tpbr;
+}
+
+static bool
+video_cap_equal(const struct di_cta_video_cap_block *a,
+		const struct di_cta_video_cap_block *b)
+{
+	return a->selectable_ycc_quantization_range == b->selectable_ycc_quantization_range &&
+	       a->selectable_rgb_quantization_range == b->selectable_rgb_quantization_range &&
+	       a->pt_over_underscan == b->pt_over_underscan &&
+	       a->it_over_underscan == b->it_over_underscan &&
+	       a->ce_over_underscan == b->ce_over_underscan;
+}
+
+static bool
+vesa_dddb_equal(const struct di_cta_vesa_dddb *a, const struct di_cta_vesa_dddb *b)
+{
+	size_t i;
+
+	if (a->interface_type != b->interface_type ||
+	    a->num_channels != b->num_channels ||
+	    a->interface_version != b->interface_version ||
+	    a->interface_release != b->interface_release ||
+	    a->content_protection != b->content_protection ||
+	    a->min_clock_freq_mhz != b->min_clock_freq_mhz ||
+	    a->max_clock_freq_mhz != b->max_clock_freq_mhz ||
+	    a->native_horiz_pixels != b->native_horiz_pixels ||
+	    a->native_vert_pixels != b->native_vert_pixels ||
+	    a->aspect_ratio != b->aspect_ratio ||
+	    a->default_orientation != b->default_orientation ||
+	    a->rotation_cap != b->rotation_cap ||
+	    a->zero_pixel_location != b->zero_pixel_location ||
+	    a->scan_direction != b->scan_direction ||
+	    a->subpixel_layout != b->subpixel_layout ||
+	    a->horiz_pitch_mm != b->horiz_pitch_mm ||
+	    a->vert_pitch_mm != b->vert_pitch_mm ||
+	    a->dithering_type != b->dithering_type ||
+	    a->direct_drive != b->direct_drive ||
+	    a->overdrive_not_recommended != b->overdrive_not_recommended ||
+	    a->deinterlacing != b->deinterlacing ||
+	    a->audio_support != b->audio_support ||
+	    a->separate_audio_inputs != b->separate_audio_inputs ||
+	    a->audio_input_override != b->audio_input_override ||
+	    a->audio_delay_provided != b->audio_delay_provided ||
+	    a->audio_delay_ms != b->audio_delay_ms ||
+	    a->frame_rate_conversion != b->frame_rate_conversion ||
+	    a->frame_rate_range_hz != b->frame_rate_range_hz ||
+	    a->frame_rate_native_hz != b->frame_rate_native_hz ||
+	    a->bit_depth_interface != b->bit_depth_interface ||
+	    a->bit_depth_display != b->bit_depth_display ||
+	    a->additional_primary_chromaticities_len != b->additional_primary_chromaticities_len ||
+	    a->resp_time_transition != b->resp_time_transition ||
+	    a->resp_time_ms != b->resp_time_ms ||
+	    a->overscan_horiz_pct != b->overscan_horiz_pct ||
+	    a->overscan_vert_pct != b->overscan_vert_pct)
+		return false;
+
+	for (i = 0; i < a->additional_primary_chromaticities_len; i++) {
+		if (a->additional_primary_chromaticities[i].x != b->additional_primary_chromaticities[i].x ||
+		    a->additional_primary_chromaticities[i].y != b->additional_primary_chromaticities[i].y)
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+colorimetry_equal(const struct di_cta_colorimetry_block *a,
+		  const struct di_cta_colorimetry_block *b)
+{
+	return a->xvycc_601 == b->xvycc_601 &&
+	       a->xvycc_709 == b->xvycc_709 &&
+	       a->sycc_601 == b->sycc_601 &&
+	       a->opycc_601 == b->opycc_601 &&
+	       a->oprgb == b->oprgb &&
+	       a->bt2020_cycc == b->bt2020_cycc &&
+	       a->bt2020_ycc == b->bt2020_ycc &&
+	       a->bt2020_rgb == b->bt2020_rgb &&
+	       a->st2113_rgb == b->st2113_rgb &&
+	       a->ictcp == b->ictcp;
+}
+
+static bool
+hdr_static_metadata_equal(const struct di_cta_hdr_static_metadata_block_priv *a,
+			  const struct di_cta_hdr_static_metadata_block_priv *b)
+{
+	return a->base.desired_content_max_luminance == b->base.desired_content_max_luminance &&
+	       a->base.desired_content_max_frame_avg_luminance == b->base.desired_content_max_frame_avg_luminance &&
+	       a->base.desired_content_min_luminance == b->base.desired_content_min_luminance &&
+	       a->eotfs.traditional_sdr == b->eotfs.traditional_sdr &&
+	       a->eotfs.traditional_hdr == b->eotfs.traditional_hdr &&
+	       a->eotfs.pq == b->eotfs.pq &&
+	       a->eotfs.hlg == b->eotfs.hlg &&
+	       a->descriptors.type1 == b->descriptors.type1;
+}
+
+static bool
+hdr_dynamic_metadata_equal(const struct di_cta_hdr_dynamic_metadata_block_priv *a,
+			   const struct di_cta_hdr_dynamic_metadata_block_priv *b)
+{
+	return !a->base.type1 == !b->base.type1 &&
+	       !a->base.type2 == !b->base.type2 &&
+	       !a->base.type3 == !b->base.type3 &&
+	       !a->base.type4 == !b->base.type4 &&
+	       !a->base.type256 == !b->base.type256 &&
+	       a->type1.type_1_hdr_metadata_version == b->type1.type_1_hdr_metadata_version &&
+	       a->type2.ts_103_433_spec_version == b->type2.ts_103_433_spec_version &&
+	       a->type2.ts_103_433_1_capable == b->type2.ts_103_433_1_capable &&
+	       a->type2.ts_103_433_2_capable == b->type2.ts_103_433_2_capable &&
+	       a->type2.ts_103_433_3_capable == b->type2.ts_103_433_3_capable &&
+	       a->type4.type_4_hdr_metadata_version == b->type4.type_4_hdr_metadata_version &&
+	       a->type256.graphics_overlay_flag_version == b->type256.graphics_overlay_flag_version;
+}
+
+static bool
+vesa_transfer_characteristics_equal(const struct di_cta_vesa_transfer_characteristics *a,
+				    const struct di_cta_vesa_transfer_characteristics *b)
+{
+	size_t i;
+
+	if (a->usage != b->usage || a->points_len != b->points_len)
+		return false;
+
+	for (i = 0; i < a->points_len; i++) {
+		if (a->points[i] != b->points[i])
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+hdmi_audio_equal(const struct di_cta_hdmi_audio_block_priv *a,
+		 const struct di_cta_hdmi_audio_block_priv *b)
+{
+	return !a->base.multi_stream == !b->base.multi_stream &&
+	       !a->base.audio_3d == !b->base.audio_3d &&
+	       a->ms.max_streams == b->ms.max_streams &&
+	       a->ms.supports_non_mixed == b->ms.supports_non_mixed &&
+	       a->a3d.channels == b->a3d.channels &&
+	       speaker_allocation_equal(&a->a3d.speakers, &b->a3d.speakers) &&
+	       sads_equal(a->sads, b->sads);
+}
+
+static bool
+infoframe_equal(const struct di_cta_infoframe_block_priv *a,
+		const struct di_cta_infoframe_block_priv *b)
+{
+	size_t i;
+
+	if (a->block.num_simultaneous_vsifs != b->block.num_simultaneous_vsifs ||
+	    a->infoframes_len != b->infoframes_len)
+		return false;
+
+	for (i = 0; i < a->infoframes_len; i++) {
+		if (a->infoframes[i]->type != b->infoframes[i]->type)
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+room_config_equal(const struct di_cta_room_configuration *a,
+		  const struct di_cta_room_configuration *b)
+{
+	return speaker_allocation_equal(&a->speakers, &b->speakers) &&
+	       a->speaker_count == b->speaker_count &&
+	       a->has_speaker_location_descriptors == b->has_speaker_location_descriptors &&
+	       a->max_x == b->max_x &&
+	       a->max_y == b->max_y &&
+	       a->max_z == b->max_z &&
+	       a->display_x == b->display_x &&
+	       a->display_y == b->display_y &&
+	       a->display_z == b->display_z;
+}
+
+static bool
+speaker_location_equal(const struct di_cta_speaker_location_block *a,
+		       const struct di_cta_speaker_location_block *b)
+{
+	const struct di_cta_speaker_locations *loc_a, *loc_b;
+	size_t i;
+
+	if (a->locations_len != b->locations_len)
+		return false;
+
+	for (i = 0; i < a->locations_len; i++) {
+		loc_a = a->locations[i];
+		loc_b = b->locations[i];
+		if (loc_a->channel_index != loc_b->channel_index ||
+		    loc_a->is_active != loc_b->is_active ||
+		    loc_a->has_coords != loc_b->has_coords ||
+		    loc_a->speaker_id != loc_b->speaker_id)
+			return false;
+		if (loc_a->has_coords &&
+		    (loc_a->x != loc_b->x || loc_a->y != loc_b->y ||
+		     loc_a->z != loc_b->z))
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+video_format_pref_equal(const struct di_cta_video_format_pref_block *a,
+			const struct di_cta_video_format_pref_block *b)
+{
+	size_t i;
+
+	if (a->svrs_len != b->svrs_len)
+		return false;
+
+	/* The video format is derived from the VIC */
+	for (i = 0; i < a->svrs_len; i++) {
+		if (a->svrs[i]->type != b->svrs[i]->type ||
+		    a->svrs[i]->vic != b->svrs[i]->vic ||
+		    a->svrs[i]->dtd_index != b->svrs[i]->dtd_index ||
+		    a->svrs[i]->t7_t10_vtdb_index != b->svrs[i]->t7_t10_vtdb_index)
+			return false;
+	}
+
+	return true;
+}
+
+bool
+_di_cta_data_block_equal(const struct di_cta_data_block *a,
+			 const struct di_cta_data_block *b)
+{
+	if (a->tag != b->tag)
+		return false;
+
+	switch (a->tag) {
+	case DI_CTA_DATA_BLOCK_VIDEO:
+		return svds_equal(a->video.svds, b->video.svds);
+	case DI_CTA_DATA_BLOCK_YCBCR420:
+		return svds_equal(a->ycbcr420.svds, b->ycbcr420.svds);
+	case DI_CTA_DATA_BLOCK_AUDIO:
+		return sads_equal(a->audio.sads, b->audio.sads);
+	case DI_CTA_DATA_BLOCK_SPEAKER_ALLOC:
+		return speaker_allocation_equal(&a->speaker_alloc.speakers,
+						&b->speaker_alloc.speakers);
+	case DI_CTA_DATA_BLOCK_VIDEO_CAP:
+		return video_cap_equal(&a->video_cap, &b->video_cap);
+	case DI_CTA_DATA_BLOCK_VESA_DISPLAY_DEVICE:
+		return vesa_dddb_equal(&a->vesa_dddb, &b->vesa_dddb);
+	case DI_CTA_DATA_BLOCK_COLORIMETRY:
+		return colorimetry_equal(&a->colorimetry, &b->colorimetry);
+	case DI_CTA_DATA_BLOCK_HDR_STATIC_METADATA:
+		return hdr_static_metadata_equal(&a->hdr_static_metadata,
+						 &b->hdr_static_metadata);
+	case DI_CTA_DATA_BLOCK_HDR_DYNAMIC_METADATA:
+		return hdr_dynamic_metadata_equal(&a->hdr_dynamic_metadata,
+						  &b->hdr_dynamic_metadata);
+	case DI_CTA_DATA_BLOCK_VESA_DISPLAY_TRANSFER_CHARACTERISTIC:
+		return vesa_transfer_characteristics_equal(&a->vesa_transfer_characteristics,
+							   &b->vesa_transfer_characteristics);
+	case DI_CTA_DATA_BLOCK_YCBCR420_CAP_MAP:
+		return a->ycbcr420_cap_map.all == b->ycbcr420_cap_map.all &&
+		       memcmp(a->ycbcr420_cap_map.svd_bitmap,
+			      b->ycbcr420_cap_map.svd_bitmap,
+			      sizeof(a->ycbcr420_cap_map.svd_bitmap)) == 0;
+	case DI_CTA_DATA_BLOCK_HDMI_AUDIO:
+		return hdmi_audio_equal(&a->hdmi_audio, &b->hdmi_audio);
+	case DI_CTA_DATA_BLOCK_INFOFRAME:
+		return infoframe_equal(&a->infoframe, &b->infoframe);
+	case DI_CTA_DATA_BLOCK_ROOM_CONFIG:
+		return room_config_equal(&a->room_config, &b->room_config);
+	case DI_CTA_DATA_BLOCK_SPEAKER_LOCATION:
+		return speaker_location_equal(&a->speaker_location,
+					      &b->speaker_location);
+	case DI_CTA_DATA_BLOCK_VIDEO_FORMAT_PREF:
+		return video_format_pref_equal(&a->video_format_pref,
+					       &b->video_format_pref);
+	case DI_CTA_DATA_BLOCK_DISPLAYID_VIDEO_TIMING_VII:
+		return _di_displayid_type_i_ii_vii_timing_equal(&a->did_vii_timing,
+								&b->did_vii_timing);
+	default:
+		/* Blocks without a parsed payload only carry their tag */
+		return true;
+	}
+}
+
 int
 di_edid_cta_get_revision(const struct di_edid_cta *cta)
 {
@@ -1955,6 +2484,15 @@ di_edid_cta_get_data_blocks(const struct di_edid_cta *cta)
 	return (const struct di_cta_data_block *const *) cta->data_blocks;
 }
 
+const struct di_cta_data_block *
+di_edid_cta_find_data_block(const struct di_edid_cta *cta,
+			    enum di_cta_data_block_tag tag)
+{
+	if (tag <= 0 || tag >= EDID_CTA_DATA_BLOCK_TAG_COUNT)
+		return NULL;
+	return cta->data_blocks_by_tag[tag];
+}
+
 enum di_cta_data_block_tag
 di_cta_data_block_get_tag(const struct di_cta_data_block *block)
 {
@@ -1979,6 +2517,12 @@ di_cta_data_block_get_ycbcr420_svds(const struct di_cta_data_block *block)
 	return (const struct di_cta_svd *const *) block->ycbcr420.svds;
 }
 
+const struct di_cta_svd *const *
+di_edid_cta_get_unknown_svds(const struct di_edid_cta *cta)
+{
+	return (const struct di_cta_svd *const *) cta->unknown_svds;
+}
+
 const struct di_cta_svr *const *
 di_cta_data_block_get_svrs(const struct di_cta_data_block *block)
 {
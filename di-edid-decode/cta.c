@@ -24,16 +24,14 @@ video_format_picture_aspect_ratio_name(enum di_cta_video_format_picture_aspect_r
 }
 
 static void
-print_vic(uint8_t vic)
+print_vic(uint8_t vic, const struct di_cta_video_format *fmt)
 {
-	const struct di_cta_video_format *fmt;
 	int32_t h_blank, v_blank, v_active;
 	double refresh, h_freq_hz, pixel_clock_mhz, h_total, v_total;
 	char buf[10];
 
 	printf("    VIC %3" PRIu8, vic);
 
-	fmt = di_cta_video_format_from_vic(vic);
 	if (fmt == NULL)
 		return;
 
@@ -67,7 +65,7 @@ print_vic(uint8_t vic)
 static void
 printf_cta_svd(const struct di_cta_svd *svd)
 {
-	print_vic(svd->vic);
+	print_vic(svd->vic, svd->video_format);
 	if (svd->native)
 		printf(" (native)");
 	printf("\n");
@@ -208,7 +208,7 @@ parse_type_i_timing(struct di_displayid *displayid,
 		    struct di_displayid_data_block *data_block,
 		    const uint8_t data[static DISPLAYID_TYPE_I_TIMING_SIZE])
 {
-	struct di_displayid_type_i_ii_vii_timing timing, *t;
+	struct di_displayid_type_i_ii_vii_timing timing = {0}, *t;
 
 	if (!_di_displayid_parse_type_1_7_timing(&timing, displayid->logger,
 						 "Video Timing Modes Type 1 - Detailed Timings Data Block",
@@ -733,6 +733,129 @@ _di_displayid_finish(struct di_displayid *displayid)
 		destroy_data_block(displayid->data_blocks[i]);
 }
 
+bool
+_di_displayid_type_i_ii_vii_timing_equal(const struct di_displayid_type_i_ii_vii_timing *a,
+					 const struct di_displayid_type_i_ii_vii_timing *b)
+{
+	return a->pixel_clock_mhz == b->pixel_clock_mhz &&
+	       a->preferred == b->preferred &&
+	       a->stereo_3d == b->stereo_3d &&
+	       a->interlaced == b->interlaced &&
+	       a->aspect_ratio == b->aspect_ratio &&
+	       a->horiz_active == b->horiz_active &&
+	       a->vert_active == b->vert_active &&
+	       a->horiz_blank == b->horiz_blank &&
+	       a->vert_blank == b->vert_blank &&
+	       a->horiz_offset == b->horiz_offset &&
+	       a->vert_offset == b->vert_offset &&
+	       a->horiz_sync_width == b->horiz_sync_width &&
+	       a->vert_sync_width == b->vert_sync_width &&
+	       a->horiz_sync_polarity == b->horiz_sync_polarity &&
+	       a->vert_sync_polarity == b->vert_sync_polarity;
+}
+
+static bool
+type_i_ii_vii_timings_equal(struct di_displayid_type_i_ii_vii_timing *const *a,
+			    struct di_displayid_type_i_ii_vii_timing *const *b)
+{
+	size_t i;
+
+	for (i = 0; a[i] && b[i]; i++) {
+		if (!_di_displayid_type_i_ii_vii_timing_equal(a[i], b[i]))
+			return false;
+	}
+
+	return !a[i] && !b[i];
+}
+
+static bool
+type_iii_timings_equal(struct di_displayid_type_iii_timing *const *a,
+		       struct di_displayid_type_iii_timing *const *b)
+{
+	size_t i;
+
+	for (i = 0; a[i] && b[i]; i++) {
+		if (a[i]->preferred != b[i]->preferred ||
+		    a[i]->algo != b[i]->algo ||
+		    a[i]->aspect_ratio != b[i]->aspect_ratio ||
+		    a[i]->horiz_active != b[i]->horiz_active ||
+		    a[i]->interlaced != b[i]->interlaced ||
+		    a[i]->refresh_rate_hz != b[i]->refresh_rate_hz)
+			return false;
+	}
+
+	return !a[i] && !b[i];
+}
+
+static bool
+display_params_equal(const struct di_displayid_display_params_priv *a,
+		     const struct di_displayid_display_params_priv *b)
+{
+	return a->base.horiz_image_mm == b->base.horiz_image_mm &&
+	       a->base.vert_image_mm == b->base.vert_image_mm &&
+	       a->base.horiz_pixels == b->base.horiz_pixels &&
+	       a->base.vert_pixels == b->base.vert_pixels &&
+	       a->base.gamma == b->base.gamma &&
+	       a->base.aspect_ratio == b->base.aspect_ratio &&
+	       a->base.bits_per_color_overall == b->base.bits_per_color_overall &&
+	       a->base.bits_per_color_native == b->base.bits_per_color_native &&
+	       a->features.audio == b->features.audio &&
+	       a->features.separate_audio_inputs == b->features.separate_audio_inputs &&
+	       a->features.audio_input_override == b->features.audio_input_override &&
+	       a->features.power_management == b->features.power_management &&
+	       a->features.fixed_timing == b->features.fixed_timing &&
+	       a->features.fixed_pixel_format == b->features.fixed_pixel_format &&
+	       a->features.ai == b->features.ai &&
+	       a->features.deinterlacing == b->features.deinterlacing;
+}
+
+static bool
+tiled_topo_equal(const struct di_displayid_tiled_topo_priv *a,
+		 const struct di_displayid_tiled_topo_priv *b)
+{
+	return a->base.total_horiz_tiles == b->base.total_horiz_tiles &&
+	       a->base.total_vert_tiles == b->base.total_vert_tiles &&
+	       a->base.horiz_tile_location == b->base.horiz_tile_location &&
+	       a->base.vert_tile_location == b->base.vert_tile_location &&
+	       a->base.horiz_tile_pixels == b->base.horiz_tile_pixels &&
+	       a->base.vert_tile_lines == b->base.vert_tile_lines &&
+	       memcmp(a->base.vendor_id, b->base.vendor_id, sizeof(a->base.vendor_id)) == 0 &&
+	       a->base.product_code == b->base.product_code &&
+	       a->base.serial_number == b->base.serial_number &&
+	       !a->base.bezel == !b->base.bezel &&
+	       a->caps.single_enclosure == b->caps.single_enclosure &&
+	       a->caps.missing_recv_behavior == b->caps.missing_recv_behavior &&
+	       a->caps.single_recv_behavior == b->caps.single_recv_behavior &&
+	       a->bezel.top_px == b->bezel.top_px &&
+	       a->bezel.bottom_px == b->bezel.bottom_px &&
+	       a->bezel.right_px == b->bezel.right_px &&
+	       a->bezel.left_px == b->bezel.left_px;
+}
+
+bool
+_di_displayid_data_block_equal(const struct di_displayid_data_block *a,
+			       const struct di_displayid_data_block *b)
+{
+	if (a->tag != b->tag)
+		return false;
+
+	switch (a->tag) {
+	case DI_DISPLAYID_DATA_BLOCK_DISPLAY_PARAMS:
+		return display_params_equal(&a->display_params, &b->display_params);
+	case DI_DISPLAYID_DATA_BLOCK_TYPE_I_TIMING:
+		return type_i_ii_vii_timings_equal(a->type_i_timings, b->type_i_timings);
+	case DI_DISPLAYID_DATA_BLOCK_TYPE_II_TIMING:
+		return type_i_ii_vii_timings_equal(a->type_ii_timings, b->type_ii_timings);
+	case DI_DISPLAYID_DATA_BLOCK_TYPE_III_TIMING:
+		return type_iii_timings_equal(a->type_iii_timings, b->type_iii_timings);
+	case DI_DISPLAYID_DATA_BLOCK_TILED_DISPLAY_TOPO:
+		return tiled_topo_equal(&a->tiled_topo, &b->tiled_topo);
+	default:
+		/* Blocks without a parsed payload only carry their tag */
+		return true;
+	}
+}
+
 int
 di_displayid_get_version(const struct di_displayid *displayid)
 {
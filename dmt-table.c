@@ -1554,3 +1554,302 @@ const struct di_dmt_timing _di_dmt_timings[] = {
 };
 
 const size_t _di_dmt_timings_len = 86;
+
+const uint8_t _di_dmt_timings_by_id[256] = {
+	[0x01] = 1,
+	[0x02] = 2,
+	[0x03] = 3,
+	[0x04] = 4,
+	[0x05] = 5,
+	[0x06] = 6,
+	[0x07] = 7,
+	[0x08] = 8,
+	[0x09] = 9,
+	[0x0A] = 10,
+	[0x0B] = 11,
+	[0x0C] = 12,
+	[0x0D] = 13,
+	[0x0E] = 14,
+	[0x0F] = 15,
+	[0x10] = 16,
+	[0x11] = 17,
+	[0x12] = 18,
+	[0x13] = 19,
+	[0x14] = 20,
+	[0x15] = 21,
+	[0x55] = 22,
+	[0x16] = 23,
+	[0x17] = 24,
+	[0x18] = 25,
+	[0x19] = 26,
+	[0x1A] = 27,
+	[0x1B] = 28,
+	[0x1C] = 29,
+	[0x1D] = 30,
+	[0x1E] = 31,
+	[0x1F] = 32,
+	[0x20] = 33,
+	[0x21] = 34,
+	[0x22] = 35,
+	[0x23] = 36,
+	[0x24] = 37,
+	[0x25] = 38,
+	[0x26] = 39,
+	[0x27] = 40,
+	[0x28] = 41,
+	[0x51] = 42,
+	[0x56] = 43,
+	[0x29] = 44,
+	[0x2A] = 45,
+	[0x2B] = 46,
+	[0x2C] = 47,
+	[0x2D] = 48,
+	[0x2E] = 49,
+	[0x2F] = 50,
+	[0x30] = 51,
+	[0x31] = 52,
+	[0x32] = 53,
+	[0x53] = 54,
+	[0x33] = 55,
+	[0x34] = 56,
+	[0x35] = 57,
+	[0x36] = 58,
+	[0x37] = 59,
+	[0x38] = 60,
+	[0x39] = 61,
+	[0x3A] = 62,
+	[0x3B] = 63,
+	[0x3C] = 64,
+	[0x3D] = 65,
+	[0x3E] = 66,
+	[0x3F] = 67,
+	[0x40] = 68,
+	[0x41] = 69,
+	[0x42] = 70,
+	[0x43] = 71,
+	[0x52] = 72,
+	[0x44] = 73,
+	[0x45] = 74,
+	[0x46] = 75,
+	[0x47] = 76,
+	[0x48] = 77,
+	[0x49] = 78,
+	[0x4A] = 79,
+	[0x4B] = 80,
+	[0x54] = 81,
+	[0x4C] = 82,
+	[0x4D] = 83,
+	[0x4E] = 84,
+	[0x4F] = 85,
+	[0x50] = 86,
+};
+
+const struct di_dmt_std_id_index _di_dmt_std_ids[] = {
+	{ 0x3119, 1 },
+	{ 0x3140, 3 },
+	{ 0x314C, 4 },
+	{ 0x314F, 5 },
+	{ 0x3159, 6 },
+	{ 0x4540, 8 },
+	{ 0x454C, 9 },
+	{ 0x454F, 10 },
+	{ 0x4559, 11 },
+	{ 0x6140, 15 },
+	{ 0x614A, 16 },
+	{ 0x614F, 17 },
+	{ 0x6159, 18 },
+	{ 0x714F, 20 },
+	{ 0x8100, 28 },
+	{ 0x810F, 29 },
+	{ 0x8119, 30 },
+	{ 0x8140, 32 },
+	{ 0x8159, 33 },
+	{ 0x8180, 35 },
+	{ 0x818F, 36 },
+	{ 0x8199, 37 },
+	{ 0x81C0, 21 },
+	{ 0x9040, 44 },
+	{ 0x904F, 45 },
+	{ 0x9059, 46 },
+	{ 0x9500, 49 },
+	{ 0x950F, 50 },
+	{ 0x9519, 51 },
+	{ 0xA940, 54 },
+	{ 0xA945, 55 },
+	{ 0xA94A, 56 },
+	{ 0xA94F, 57 },
+	{ 0xA959, 58 },
+	{ 0xA9C0, 53 },
+	{ 0xB300, 61 },
+	{ 0xB30F, 62 },
+	{ 0xB319, 63 },
+	{ 0xC140, 65 },
+	{ 0xC14F, 66 },
+	{ 0xC940, 68 },
+	{ 0xC94F, 69 },
+	{ 0xD100, 73 },
+	{ 0xD10F, 74 },
+	{ 0xD119, 75 },
+	{ 0xD140, 77 },
+	{ 0xD14F, 78 },
+	{ 0xD1C0, 71 },
+	{ 0xE1C0, 80 },
+};
+
+const size_t _di_dmt_std_ids_len = 49;
+
+const uint8_t _di_dmt_timings_by_res[] = {
+	0, /* 640x350 */
+	1, /* 640x400 */
+	3, /* 640x480 */
+	4, /* 640x480 */
+	5, /* 640x480 */
+	6, /* 640x480 */
+	2, /* 720x400 */
+	7, /* 800x600 */
+	8, /* 800x600 */
+	9, /* 800x600 */
+	10, /* 800x600 */
+	11, /* 800x600 */
+	12, /* 800x600 */
+	13, /* 848x480 */
+	14, /* 1024x768 */
+	15, /* 1024x768 */
+	16, /* 1024x768 */
+	17, /* 1024x768 */
+	18, /* 1024x768 */
+	19, /* 1024x768 */
+	20, /* 1152x864 */
+	21, /* 1280x720 */
+	22, /* 1280x768 */
+	23, /* 1280x768 */
+	24, /* 1280x768 */
+	25, /* 1280x768 */
+	26, /* 1280x768 */
+	27, /* 1280x800 */
+	28, /* 1280x800 */
+	29, /* 1280x800 */
+	30, /* 1280x800 */
+	31, /* 1280x800 */
+	32, /* 1280x960 */
+	33, /* 1280x960 */
+	34, /* 1280x960 */
+	35, /* 1280x1024 */
+	36, /* 1280x1024 */
+	37, /* 1280x1024 */
+	38, /* 1280x1024 */
+	39, /* 1360x768 */
+	40, /* 1360x768 */
+	41, /* 1366x768 */
+	42, /* 1366x768 */
+	43, /* 1400x1050 */
+	44, /* 1400x1050 */
+	45, /* 1400x1050 */
+	46, /* 1400x1050 */
+	47, /* 1400x1050 */
+	48, /* 1440x900 */
+	49, /* 1440x900 */
+	50, /* 1440x900 */
+	51, /* 1440x900 */
+	52, /* 1440x900 */
+	53, /* 1600x900 */
+	54, /* 1600x1200 */
+	55, /* 1600x1200 */
+	56, /* 1600x1200 */
+	57, /* 1600x1200 */
+	58, /* 1600x1200 */
+	59, /* 1600x1200 */
+	60, /* 1680x1050 */
+	61, /* 1680x1050 */
+	62, /* 1680x1050 */
+	63, /* 1680x1050 */
+	64, /* 1680x1050 */
+	65, /* 1792x1344 */
+	66, /* 1792x1344 */
+	67, /* 1792x1344 */
+	68, /* 1856x1392 */
+	69, /* 1856x1392 */
+	70, /* 1856x1392 */
+	71, /* 1920x1080 */
+	72, /* 1920x1200 */
+	73, /* 1920x1200 */
+	74, /* 1920x1200 */
+	75, /* 1920x1200 */
+	76, /* 1920x1200 */
+	77, /* 1920x1440 */
+	78, /* 1920x1440 */
+	79, /* 1920x1440 */
+	80, /* 2048x1152 */
+	81, /* 2560x1600 */
+	82, /* 2560x1600 */
+	83, /* 2560x1600 */
+	84, /* 2560x1600 */
+	85, /* 2560x1600 */
+};
+
+const uint8_t _di_dmt_established_timings_i_ii[17] = {
+	0,
+	0,
+	4, /* 640x480 @ 60 Hz */
+	0,
+	5, /* 640x480 @ 72 Hz */
+	6, /* 640x480 @ 75 Hz */
+	8, /* 800x600 @ 56 Hz */
+	9, /* 800x600 @ 60 Hz */
+	10, /* 800x600 @ 72 Hz */
+	11, /* 800x600 @ 75 Hz */
+	0,
+	15, /* 1024x768 @ 43 Hz */
+	16, /* 1024x768 @ 60 Hz */
+	17, /* 1024x768 @ 70 Hz */
+	18, /* 1024x768 @ 75 Hz */
+	37, /* 1280x1024 @ 75 Hz */
+	0,
+};
+
+const uint8_t _di_dmt_established_timings_iii[44] = {
+	1, /* 640x350 @ 85 Hz */
+	2, /* 640x400 @ 85 Hz */
+	3, /* 720x400 @ 85 Hz */
+	7, /* 640x480 @ 85 Hz */
+	14, /* 848x480 @ 60 Hz */
+	12, /* 800x600 @ 85 Hz */
+	19, /* 1024x768 @ 85 Hz */
+	21, /* 1152x864 @ 75 Hz */
+	23, /* 1280x768 @ 60 Hz (RB) */
+	24, /* 1280x768 @ 60 Hz */
+	25, /* 1280x768 @ 75 Hz */
+	26, /* 1280x768 @ 85 Hz */
+	33, /* 1280x960 @ 60 Hz */
+	34, /* 1280x960 @ 85 Hz */
+	36, /* 1280x1024 @ 60 Hz */
+	38, /* 1280x1024 @ 85 Hz */
+	40, /* 1360x768 @ 60 Hz */
+	49, /* 1440x900 @ 60 Hz (RB) */
+	50, /* 1440x900 @ 60 Hz */
+	51, /* 1440x900 @ 75 Hz */
+	52, /* 1440x900 @ 85 Hz */
+	44, /* 1400x1050 @ 60 Hz (RB) */
+	45, /* 1400x1050 @ 60 Hz */
+	46, /* 1400x1050 @ 75 Hz */
+	47, /* 1400x1050 @ 85 Hz */
+	61, /* 1680x1050 @ 60 Hz (RB) */
+	62, /* 1680x1050 @ 60 Hz */
+	63, /* 1680x1050 @ 75 Hz */
+	64, /* 1680x1050 @ 85 Hz */
+	55, /* 1600x1200 @ 60 Hz */
+	56, /* 1600x1200 @ 65 Hz */
+	57, /* 1600x1200 @ 70 Hz */
+	58, /* 1600x1200 @ 75 Hz */
+	59, /* 1600x1200 @ 85 Hz */
+	66, /* 1792x1344 @ 60 Hz */
+	67, /* 1792x1344 @ 75 Hz */
+	69, /* 1856x1392 @ 60 Hz */
+	70, /* 1856x1392 @ 75 Hz */
+	73, /* 1920x1200 @ 60 Hz (RB) */
+	74, /* 1920x1200 @ 60 Hz */
+	75, /* 1920x1200 @ 75 Hz */
+	76, /* 1920x1200 @ 85 Hz */
+	78, /* 1920x1440 @ 60 Hz */
+	79, /* 1920x1440 @ 75 Hz */
+};
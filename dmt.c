@@ -0,0 +1,87 @@
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "cta.h"
+#include "dmt.h"
+
+const struct di_dmt_timing *
+di_dmt_find_by_id(uint8_t dmt_id)
+{
+	uint8_t index = _di_dmt_timings_by_id[dmt_id];
+
+	if (index == 0)
+		return NULL;
+	return &_di_dmt_timings[index - 1];
+}
+
+uint8_t
+di_dmt_timing_get_vic(const struct di_dmt_timing *t)
+{
+	return _di_cta_vic_by_dmt_id[t->dmt_id];
+}
+
+/**
+ * Maximum difference between a requested and a nominal refresh rate.
+ */
+#define REFRESH_RATE_TOLERANCE_HZ 0.5f
+
+const struct di_dmt_timing *
+di_dmt_find(int32_t horiz_video, int32_t vert_video, float refresh_rate_hz,
+	    bool reduced_blanking)
+{
+	size_t lo, hi, mid;
+	const struct di_dmt_timing *t, *best = NULL;
+	float diff, best_diff = 0;
+
+	/* Lower bound of the resolution in the sorted index */
+	lo = 0;
+	hi = _di_dmt_timings_len;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		t = &_di_dmt_timings[_di_dmt_timings_by_res[mid]];
+		if (t->horiz_video < horiz_video ||
+		    (t->horiz_video == horiz_video && t->vert_video < vert_video))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for (; lo < _di_dmt_timings_len; lo++) {
+		t = &_di_dmt_timings[_di_dmt_timings_by_res[lo]];
+		if (t->horiz_video != horiz_video || t->vert_video != vert_video)
+			break;
+		if (t->reduced_blanking != reduced_blanking)
+			continue;
+		diff = fabsf(t->refresh_rate_hz - refresh_rate_hz);
+		if (diff <= REFRESH_RATE_TOLERANCE_HZ && (!best || diff < best_diff)) {
+			best = t;
+			best_diff = diff;
+		}
+	}
+
+	return best;
+}
+
+static int
+std_id_index_compare(const void *key, const void *elem)
+{
+	uint16_t edid_std_id = *(const uint16_t *) key;
+	const struct di_dmt_std_id_index *entry = elem;
+
+	if (edid_std_id < entry->edid_std_id)
+		return -1;
+	return edid_std_id > entry->edid_std_id;
+}
+
+const struct di_dmt_timing *
+_di_dmt_find_by_std_id(uint16_t edid_std_id)
+{
+	const struct di_dmt_std_id_index *entry;
+
+	entry = bsearch(&edid_std_id, _di_dmt_std_ids, _di_dmt_std_ids_len,
+			sizeof(_di_dmt_std_ids[0]), std_id_index_compare);
+	if (!entry)
+		return NULL;
+	return &_di_dmt_timings[entry->index];
+}
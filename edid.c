@@ -299,6 +299,8 @@ parse_established_timings_i_ii(struct di_edid *edid,
 			       const uint8_t data[static EDID_BLOCK_SIZE])
 {
 	struct di_edid_established_timings_i_ii *timings = &edid->established_timings_i_ii;
+	size_t i;
+	uint8_t index;
 
 	timings->has_720x400_70hz = has_bit(data[0x23], 7);
 	timings->has_720x400_88hz = has_bit(data[0x23], 6);
@@ -321,13 +323,23 @@ parse_established_timings_i_ii(struct di_edid *edid,
 
 	timings->has_1152x870_75hz = has_bit(data[0x25], 7);
 	/* TODO: manufacturer specified timings in bits 6:0 */
+
+	for (i = 0; i < DMT_ESTABLISHED_TIMINGS_I_II_COUNT; i++) {
+		index = _di_dmt_established_timings_i_ii[i];
+		if (index != 0 && has_bit(data[0x23 + i / 8], 7 - i % 8)) {
+			assert(edid->established_timings_i_ii_dmts_len < EDID_MAX_ESTABLISHED_TIMING_I_II_DMT_COUNT);
+			edid->established_timings_i_ii_dmts[edid->established_timings_i_ii_dmts_len++] =
+				&_di_dmt_timings[index - 1];
+		}
+	}
 }
 
 static bool
 parse_standard_timing(struct di_edid *edid,
 		      const uint8_t data[static EDID_STANDARD_TIMING_SIZE],
-		      struct di_edid_standard_timing **out)
+		      struct di_edid_standard_timing_priv **out)
 {
+	struct di_edid_standard_timing_priv *priv;
 	struct di_edid_standard_timing *t;
 
 	*out = NULL;
@@ -343,16 +355,19 @@ parse_standard_timing(struct di_edid *edid,
 		return true;
 	}
 
-	t = calloc(1, sizeof(*t));
-	if (!t) {
+	priv = calloc(1, sizeof(*priv));
+	if (!priv) {
 		return false;
 	}
 
+	t = &priv->base;
 	t->horiz_video = ((int32_t) data[0] + 31) * 8;
 	t->aspect_ratio = get_bit_range(data[1], 7, 6);
 	t->refresh_rate_hz = (int32_t) get_bit_range(data[1], 5, 0) + 60;
 
-	*out = t;
+	priv->dmt = _di_dmt_find_by_std_id((uint16_t) (data[0] << 8 | data[1]));
+
+	*out = priv;
 	return true;
 }
 
@@ -723,7 +738,7 @@ parse_standard_timings_descriptor(struct di_edid *edid,
 				  const uint8_t data[static EDID_BYTE_DESCRIPTOR_SIZE],
 				  struct di_edid_display_descriptor *desc)
 {
-	struct di_edid_standard_timing *t;
+	struct di_edid_standard_timing_priv *t;
 	size_t i;
 	const uint8_t *timing_data;
 
@@ -744,104 +759,31 @@ parse_standard_timings_descriptor(struct di_edid *edid,
 	return true;
 }
 
-/**
- * Mapping table for established timings III.
- *
- * Contains one entry per bit, with the value set to the DMT ID.
- */
-static const uint8_t established_timings_iii[] = {
-	/* 0x06 */
-	0x01, /* 640 x 350 @ 85 Hz */
-	0x02, /* 640 x 400 @ 85 Hz */
-	0x03, /* 720 x 400 @ 85 Hz */
-	0x07, /* 640 x 480 @ 85 Hz */
-	0x0e, /* 848 x 480 @ 60 Hz */
-	0x0c, /* 800 x 600 @ 85 Hz */
-	0x13, /* 1024 x 768 @ 85 Hz */
-	0x15, /* 1152 x 864 @ 75 Hz */
-	/* 0x07 */
-	0x16, /* 1280 x 768 @ 60 Hz (RB) */
-	0x17, /* 1280 x 768 @ 60 Hz */
-	0x18, /* 1280 x 768 @ 75 Hz */
-	0x19, /* 1280 x 768 @ 85 Hz */
-	0x20, /* 1280 x 960 @ 60 Hz */
-	0x21, /* 1280 x 960 @ 85 Hz */
-	0x23, /* 1280 x 1024 @ 60 Hz */
-	0x25, /* 1280 x 1024 @ 85 Hz */
-	/* 0x08 */
-	0x27, /* 1360 x 768 @ 60 Hz */
-	0x2e, /* 1440 x 900 @ 60 Hz (RB) */
-	0x2f, /* 1440 x 900 @ 60 Hz */
-	0x30, /* 1440 x 900 @ 75 Hz */
-	0x31, /* 1440 x 900 @ 85 Hz */
-	0x29, /* 1400 x 1050 @ 60 Hz (RB) */
-	0x2a, /* 1400 x 1050 @ 60 Hz */
-	0x2b, /* 1400 x 1050 @ 75 Hz */
-	/* 0x09 */
-	0x2c, /* 1400 x 1050 @ 85 Hz */
-	0x39, /* 1680 x 1050 @ 60 Hz (RB) */
-	0x3a, /* 1680 x 1050 @ 60 Hz */
-	0x3b, /* 1680 x 1050 @ 75 Hz */
-	0x3c, /* 1680 x 1050 @ 85 Hz */
-	0x33, /* 1600 x 1200 @ 60 Hz */
-	0x34, /* 1600 x 1200 @ 65 Hz */
-	0x35, /* 1600 x 1200 @ 70 Hz */
-	/* 0x0a */
-	0x36, /* 1600 x 1200 @ 75 Hz */
-	0x37, /* 1600 x 1200 @ 85 Hz */
-	0x3e, /* 1792 x 1344 @ 60 Hz */
-	0x3f, /* 1792 x 1344 @ 75 Hz */
-	0x41, /* 1856 x 1392 @ 60 Hz */
-	0x42, /* 1856 x 1392 @ 75 Hz */
-	0x44, /* 1920 x 1200 @ 60 Hz (RB) */
-	0x45, /* 1920 x 1200 @ 60 Hz */
-	/* 0x0b */
-	0x46, /* 1920 x 1200 @ 75 Hz */
-	0x47, /* 1920 x 1200 @ 85 Hz */
-	0x49, /* 1920 x 1440 @ 60 Hz */
-	0x4a, /* 1920 x 1440 @ 75 Hz */
-};
 static_assert(EDID_MAX_DESCRIPTOR_ESTABLISHED_TIMING_III_COUNT
-	      == sizeof(established_timings_iii) / sizeof(established_timings_iii[0]),
+	      == DMT_ESTABLISHED_TIMINGS_III_COUNT,
 	      "Invalid number of established timings III in table");
 
-static const struct di_dmt_timing *
-get_dmt_timing(uint8_t dmt_id)
-{
-	size_t i;
-	const struct di_dmt_timing *t;
-
-	for (i = 0; i < _di_dmt_timings_len; i++) {
-		t = &_di_dmt_timings[i];
-		if (t->dmt_id == dmt_id)
-			return t;
-	}
-
-	return NULL;
-}
-
 static void
 parse_established_timings_iii_descriptor(struct di_edid *edid,
 					 const uint8_t data[static EDID_BYTE_DESCRIPTOR_SIZE],
 					 struct di_edid_display_descriptor *desc)
 {
 	size_t i, offset, bit;
-	uint8_t dmt_id;
-	const struct di_dmt_timing *t;
+	uint8_t index;
 	bool has_zeroes;
 
 	if (edid->revision < 4)
 		add_failure(edid, "Established timings III: Not allowed for EDID < 1.4.");
 
 	for (i = 0; i < EDID_MAX_DESCRIPTOR_ESTABLISHED_TIMING_III_COUNT; i++) {
-		dmt_id = established_timings_iii[i];
+		index = _di_dmt_established_timings_iii[i];
 		offset = 0x06 + i / 8;
 		bit = 7 - i % 8;
 		assert(offset < EDID_BYTE_DESCRIPTOR_SIZE);
+		assert(index != 0);
 		if (has_bit(data[offset], bit)) {
-			t = get_dmt_timing(dmt_id);
-			assert(t != NULL);
-			desc->established_timings_iii[desc->established_timings_iii_len++] = t;
+			desc->established_timings_iii[desc->established_timings_iii_len++] =
+				&_di_dmt_timings[index - 1];
 		}
 	}
 
@@ -1129,6 +1071,7 @@ parse_ext(struct di_edid *edid, const uint8_t data[static EDID_BLOCK_SIZE])
 	uint8_t tag;
 	struct di_logger logger;
 	char section_name[64];
+	size_t i;
 
 	if (!validate_block_checksum(data)) {
 		errno = EINVAL;
@@ -1189,6 +1132,14 @@ parse_ext(struct di_edid *edid, const uint8_t data[static EDID_BLOCK_SIZE])
 	ext->tag = tag;
 	assert(edid->exts_len < EDID_MAX_BLOCK_COUNT - 1);
 	edid->exts[edid->exts_len++] = ext;
+
+	if (tag == DI_EDID_EXT_CEA) {
+		for (i = 0; i < EDID_CTA_DATA_BLOCK_TAG_COUNT; i++) {
+			if (!edid->cta_data_blocks_by_tag[i])
+				edid->cta_data_blocks_by_tag[i] = ext->cta.data_blocks_by_tag[i];
+		}
+	}
+
 	return true;
 }
 
@@ -1200,7 +1151,7 @@ _di_edid_parse(const void *data, size_t size, FILE *failure_msg_file)
 	int version, revision;
 	size_t exts_len, parsed_ext_len, i;
 	const uint8_t *standard_timing_data, *byte_desc_data, *ext_data;
-	struct di_edid_standard_timing *standard_timing;
+	struct di_edid_standard_timing_priv *standard_timing;
 
 	if (size < EDID_BLOCK_SIZE) {
 		errno = EINVAL;
@@ -1359,6 +1310,164 @@ _di_edid_destroy(struct di_edid *edid)
 	free(edid);
 }
 
+bool
+_di_edid_detailed_timing_def_equal(const struct di_edid_detailed_timing_def_priv *a,
+				   const struct di_edid_detailed_timing_def_priv *b)
+{
+	return a->base.pixel_clock_hz == b->base.pixel_clock_hz &&
+	       a->base.horiz_video == b->base.horiz_video &&
+	       a->base.vert_video == b->base.vert_video &&
+	       a->base.horiz_blank == b->base.horiz_blank &&
+	       a->base.vert_blank == b->base.vert_blank &&
+	       a->base.horiz_front_porch == b->base.horiz_front_porch &&
+	       a->base.vert_front_porch == b->base.vert_front_porch &&
+	       a->base.horiz_sync_pulse == b->base.horiz_sync_pulse &&
+	       a->base.vert_sync_pulse == b->base.vert_sync_pulse &&
+	       a->base.horiz_image_mm == b->base.horiz_image_mm &&
+	       a->base.vert_image_mm == b->base.vert_image_mm &&
+	       a->base.horiz_border == b->base.horiz_border &&
+	       a->base.vert_border == b->base.vert_border &&
+	       a->base.interlaced == b->base.interlaced &&
+	       a->base.stereo == b->base.stereo &&
+	       a->base.signal_type == b->base.signal_type &&
+	       a->analog_composite.sync_serrations == b->analog_composite.sync_serrations &&
+	       a->analog_composite.sync_on_green == b->analog_composite.sync_on_green &&
+	       a->bipolar_analog_composite.sync_serrations == b->bipolar_analog_composite.sync_serrations &&
+	       a->bipolar_analog_composite.sync_on_green == b->bipolar_analog_composite.sync_on_green &&
+	       a->digital_composite.sync_serrations == b->digital_composite.sync_serrations &&
+	       a->digital_composite.sync_horiz_polarity == b->digital_composite.sync_horiz_polarity &&
+	       a->digital_separate.sync_vert_polarity == b->digital_separate.sync_vert_polarity &&
+	       a->digital_separate.sync_horiz_polarity == b->digital_separate.sync_horiz_polarity;
+}
+
+static bool
+display_range_limits_equal(const struct di_edid_display_range_limits_priv *a,
+			   const struct di_edid_display_range_limits_priv *b)
+{
+	return a->base.min_vert_rate_hz == b->base.min_vert_rate_hz &&
+	       a->base.max_vert_rate_hz == b->base.max_vert_rate_hz &&
+	       a->base.min_horiz_rate_hz == b->base.min_horiz_rate_hz &&
+	       a->base.max_horiz_rate_hz == b->base.max_horiz_rate_hz &&
+	       a->base.max_pixel_clock_hz == b->base.max_pixel_clock_hz &&
+	       a->base.type == b->base.type &&
+	       a->secondary_gtf.start_freq_hz == b->secondary_gtf.start_freq_hz &&
+	       a->secondary_gtf.c == b->secondary_gtf.c &&
+	       a->secondary_gtf.m == b->secondary_gtf.m &&
+	       a->secondary_gtf.k == b->secondary_gtf.k &&
+	       a->secondary_gtf.j == b->secondary_gtf.j &&
+	       a->cvt.version == b->cvt.version &&
+	       a->cvt.revision == b->cvt.revision &&
+	       a->cvt.max_horiz_px == b->cvt.max_horiz_px &&
+	       a->cvt.supported_aspect_ratio == b->cvt.supported_aspect_ratio &&
+	       a->cvt.preferred_aspect_ratio == b->cvt.preferred_aspect_ratio &&
+	       a->cvt.standard_blanking == b->cvt.standard_blanking &&
+	       a->cvt.reduced_blanking == b->cvt.reduced_blanking &&
+	       a->cvt.supported_scaling == b->cvt.supported_scaling &&
+	       a->cvt.preferred_vert_refresh_hz == b->cvt.preferred_vert_refresh_hz;
+}
+
+static bool
+color_point_equal(const struct di_edid_color_point *a,
+		  const struct di_edid_color_point *b)
+{
+	return a->index == b->index &&
+	       a->white_x == b->white_x &&
+	       a->white_y == b->white_y &&
+	       a->gamma == b->gamma;
+}
+
+static bool
+color_management_data_equal(const struct di_edid_color_management_data *a,
+			    const struct di_edid_color_management_data *b)
+{
+	return a->version == b->version &&
+	       a->red_a3 == b->red_a3 &&
+	       a->red_a2 == b->red_a2 &&
+	       a->green_a3 == b->green_a3 &&
+	       a->green_a2 == b->green_a2 &&
+	       a->blue_a3 == b->blue_a3 &&
+	       a->blue_a2 == b->blue_a2;
+}
+
+static bool
+cvt_timing_code_equal(const struct di_edid_cvt_timing_code *a,
+		      const struct di_edid_cvt_timing_code *b)
+{
+	return a->addressable_lines_per_field == b->addressable_lines_per_field &&
+	       a->aspect_ratio == b->aspect_ratio &&
+	       a->supports_50hz_sb == b->supports_50hz_sb &&
+	       a->supports_60hz_sb == b->supports_60hz_sb &&
+	       a->supports_75hz_sb == b->supports_75hz_sb &&
+	       a->supports_85hz_sb == b->supports_85hz_sb &&
+	       a->supports_60hz_rb == b->supports_60hz_rb &&
+	       a->preferred_vertical_rate == b->preferred_vertical_rate;
+}
+
+bool
+_di_edid_standard_timings_equal(struct di_edid_standard_timing_priv *const *a,
+				struct di_edid_standard_timing_priv *const *b)
+{
+	size_t i;
+
+	/* The DMT pointer is derived from the base fields */
+	for (i = 0; a[i] && b[i]; i++) {
+		if (a[i]->base.horiz_video != b[i]->base.horiz_video ||
+		    a[i]->base.aspect_ratio != b[i]->base.aspect_ratio ||
+		    a[i]->base.refresh_rate_hz != b[i]->base.refresh_rate_hz)
+			return false;
+	}
+
+	return !a[i] && !b[i];
+}
+
+bool
+_di_edid_display_descriptor_equal(const struct di_edid_display_descriptor *a,
+				  const struct di_edid_display_descriptor *b)
+{
+	size_t i;
+
+	if (a->tag != b->tag)
+		return false;
+
+	switch (a->tag) {
+	case DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_SERIAL:
+	case DI_EDID_DISPLAY_DESCRIPTOR_DATA_STRING:
+	case DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_NAME:
+		return strcmp(a->str, b->str) == 0;
+	case DI_EDID_DISPLAY_DESCRIPTOR_RANGE_LIMITS:
+		return display_range_limits_equal(&a->range_limits, &b->range_limits);
+	case DI_EDID_DISPLAY_DESCRIPTOR_STD_TIMING_IDS:
+		return _di_edid_standard_timings_equal(a->standard_timings,
+						       b->standard_timings);
+	case DI_EDID_DISPLAY_DESCRIPTOR_COLOR_POINT:
+		if (a->color_points_len != b->color_points_len)
+			return false;
+		for (i = 0; i < a->color_points_len; i++) {
+			if (!color_point_equal(a->color_points[i], b->color_points[i]))
+				return false;
+		}
+		return true;
+	case DI_EDID_DISPLAY_DESCRIPTOR_ESTABLISHED_TIMINGS_III:
+		/* DMT timings point into a static table */
+		return a->established_timings_iii_len == b->established_timings_iii_len &&
+		       memcmp(a->established_timings_iii, b->established_timings_iii,
+			      a->established_timings_iii_len * sizeof(a->established_timings_iii[0])) == 0;
+	case DI_EDID_DISPLAY_DESCRIPTOR_DCM_DATA:
+		return color_management_data_equal(&a->dcm_data, &b->dcm_data);
+	case DI_EDID_DISPLAY_DESCRIPTOR_CVT_TIMING_CODES:
+		if (a->cvt_timing_codes_len != b->cvt_timing_codes_len)
+			return false;
+		for (i = 0; i < a->cvt_timing_codes_len; i++) {
+			if (!cvt_timing_code_equal(a->cvt_timing_codes[i],
+						   b->cvt_timing_codes[i]))
+				return false;
+		}
+		return true;
+	default:
+		return true;
+	}
+}
+
 int
 di_edid_get_version(const struct di_edid *edid)
 {
@@ -1439,6 +1548,12 @@ di_edid_get_established_timings_i_ii(const struct di_edid *edid)
 	return &edid->established_timings_i_ii;
 }
 
+const struct di_dmt_timing *const *
+di_edid_get_established_timings_i_ii_dmts(const struct di_edid *edid)
+{
+	return edid->established_timings_i_ii_dmts;
+}
+
 int32_t
 di_edid_standard_timing_get_vert_video(const struct di_edid_standard_timing *t)
 {
@@ -1458,24 +1573,10 @@ di_edid_standard_timing_get_vert_video(const struct di_edid_standard_timing *t)
 const struct di_dmt_timing *
 di_edid_standard_timing_get_dmt(const struct di_edid_standard_timing *t)
 {
-	int32_t vert_video;
-	size_t i;
-	const struct di_dmt_timing *dmt;
-
-	vert_video = di_edid_standard_timing_get_vert_video(t);
+	const struct di_edid_standard_timing_priv *priv =
+		(const struct di_edid_standard_timing_priv *) t;
 
-	for (i = 0; i < _di_dmt_timings_len; i++) {
-		dmt = &_di_dmt_timings[i];
-
-		if (dmt->horiz_video == t->horiz_video
-		    && dmt->vert_video == vert_video
-		    && dmt->refresh_rate_hz == (float)t->refresh_rate_hz
-		    && dmt->edid_std_id != 0) {
-			return dmt;
-		}
-	}
-
-	return 0;
+	return priv->dmt;
 }
 
 const struct di_edid_standard_timing *const *
@@ -1590,6 +1691,15 @@ di_edid_ext_get_cta(const struct di_edid_ext *ext)
 	return &ext->cta;
 }
 
+const struct di_cta_data_block *
+di_edid_find_cta_data_block(const struct di_edid *edid,
+			    enum di_cta_data_block_tag tag)
+{
+	if (tag <= 0 || tag >= EDID_CTA_DATA_BLOCK_TAG_COUNT)
+		return NULL;
+	return edid->cta_data_blocks_by_tag[tag];
+}
+
 const struct di_displayid *
 di_edid_ext_get_displayid(const struct di_edid_ext *ext)
 {
@@ -34,6 +34,14 @@
  * is 63 bytes, and each SVD uses 1 byte.
  */
 #define EDID_CTA_MAX_VIDEO_BLOCK_ENTRIES 63
+/**
+ * The maximum number of SVDs in a CTA block, across all video data blocks
+ * and YCbCr 4:2:0 video data blocks.
+ *
+ * The CTA block can hold 128 bytes, the mandatory fields take up 5 bytes,
+ * each data block header takes up at least 1 byte and each SVD uses 1 byte.
+ */
+#define EDID_CTA_MAX_SVDS 122
 /**
  * The maximum number of SAD entries in an audio data block.
  *
@@ -80,6 +88,11 @@
  * is 63 bytes, the header takes up 2 bytes and each format entry uses 4 bytes.
  */
 #define EDID_CTA_MAX_HDMI_AUDIO_BLOCK_ENTRIES 15
+/**
+ * The number of entries in a tag-indexed data block table, enum
+ * di_cta_data_block_tag values start at 1.
+ */
+#define EDID_CTA_DATA_BLOCK_TAG_COUNT (DI_CTA_DATA_BLOCK_HDMI_SINK_CAP + 1)
 
 struct di_edid_cta {
 	int revision;
@@ -88,11 +101,20 @@ struct di_edid_cta {
 	/* NULL-terminated */
 	struct di_cta_data_block *data_blocks[EDID_CTA_MAX_DATA_BLOCKS + 1];
 	size_t data_blocks_len;
+	/* First data block for each tag, NULL if none */
+	struct di_cta_data_block *data_blocks_by_tag[EDID_CTA_DATA_BLOCK_TAG_COUNT];
+	/* NULL-terminated, SVDs with an unknown VIC, owned by the data blocks */
+	struct di_cta_svd *unknown_svds[EDID_CTA_MAX_SVDS + 1];
+	size_t unknown_svds_len;
 
 	/* NULL-terminated */
 	struct di_edid_detailed_timing_def_priv *detailed_timing_defs[EDID_CTA_MAX_DETAILED_TIMING_DEFS + 1];
 	size_t detailed_timing_defs_len;
 
+	/* VRRmin and VRRmax from the first HDMI Forum Sink Capability Data
+	 * Structure, in Hz, zero if unset */
+	int32_t hdmi_vrr_min_hz, hdmi_vrr_max_hz;
+
 	struct di_logger *logger;
 };
 
@@ -212,8 +234,21 @@ struct di_cta_data_block {
 	struct di_displayid_type_i_ii_vii_timing did_vii_timing;
 };
 
+/* Sorted by VIC, without holes */
 extern const struct di_cta_video_format _di_cta_video_formats[];
 extern const size_t _di_cta_video_formats_len;
+/* Index into _di_cta_video_formats plus one for each VIC, zero if unknown */
+extern const uint8_t _di_cta_video_formats_by_vic[256];
+/* Hot fields of _di_cta_video_formats, with the same indices */
+extern const uint16_t _di_cta_video_formats_h_active[];
+extern const uint16_t _di_cta_video_formats_v_active[];
+extern const uint32_t _di_cta_video_formats_pixel_clock_khz[];
+/* Indices into _di_cta_video_formats sorted by resolution */
+extern const uint8_t _di_cta_video_formats_by_res[];
+/* DMT ID with identical timings for each video format, zero if none */
+extern const uint8_t _di_cta_video_formats_dmt_id[];
+/* Lowest VIC with identical timings for each DMT ID, zero if none */
+extern const uint8_t _di_cta_vic_by_dmt_id[256];
 
 bool
 _di_edid_cta_parse(struct di_edid_cta *cta, const uint8_t *data, size_t size,
@@ -222,4 +257,11 @@ _di_edid_cta_parse(struct di_edid_cta *cta, const uint8_t *data, size_t size,
 void
 _di_edid_cta_finish(struct di_edid_cta *cta);
 
+/**
+ * Check whether two CTA data blocks carry the same parsed information.
+ */
+bool
+_di_cta_data_block_equal(const struct di_cta_data_block *a,
+			 const struct di_cta_data_block *b);
+
 #endif
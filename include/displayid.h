@@ -92,6 +92,13 @@ _di_displayid_parse(struct di_displayid *displayid, const uint8_t *data,
 void
 _di_displayid_finish(struct di_displayid *displayid);
 
+/**
+ * Check whether two DisplayID data blocks carry the same parsed information.
+ */
+bool
+_di_displayid_data_block_equal(const struct di_displayid_data_block *a,
+			       const struct di_displayid_data_block *b);
+
 bool
 _di_displayid_parse_type_1_7_timing(struct di_displayid_type_i_ii_vii_timing *timing,
 				    struct di_logger *logger,
@@ -99,4 +106,11 @@ _di_displayid_parse_type_1_7_timing(struct di_displayid_type_i_ii_vii_timing *ti
 				    const uint8_t *data,
 				    bool is_type7);
 
+/**
+ * Check whether two type I, II or VII timings are equal.
+ */
+bool
+_di_displayid_type_i_ii_vii_timing_equal(const struct di_displayid_type_i_ii_vii_timing *a,
+					 const struct di_displayid_type_i_ii_vii_timing *b);
+
 #endif
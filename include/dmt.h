@@ -5,11 +5,48 @@
  * Private header for VESA Display Monitor Timing.
  */
 
+#include <stdint.h>
 #include <sys/types.h>
 
 #include <libdisplay-info/dmt.h>
 
 extern const struct di_dmt_timing _di_dmt_timings[];
 extern const size_t _di_dmt_timings_len;
+/* Index into _di_dmt_timings plus one for each DMT ID, zero if unknown */
+extern const uint8_t _di_dmt_timings_by_id[256];
+/* Indices into _di_dmt_timings sorted by resolution */
+extern const uint8_t _di_dmt_timings_by_res[];
+
+/**
+ * Number of established timings I and II bits, including the first bit of
+ * the manufacturer's timings byte.
+ */
+#define DMT_ESTABLISHED_TIMINGS_I_II_COUNT 17
+/**
+ * Number of established timings III bits.
+ */
+#define DMT_ESTABLISHED_TIMINGS_III_COUNT 44
+
+/* Index into _di_dmt_timings plus one for each established timing bit, zero if
+ * the established timing isn't a DMT timing */
+extern const uint8_t _di_dmt_established_timings_i_ii[DMT_ESTABLISHED_TIMINGS_I_II_COUNT];
+extern const uint8_t _di_dmt_established_timings_iii[DMT_ESTABLISHED_TIMINGS_III_COUNT];
+
+struct di_dmt_std_id_index {
+	uint16_t edid_std_id;
+	uint8_t index; /* into _di_dmt_timings */
+};
+
+/* Sorted by edid_std_id */
+extern const struct di_dmt_std_id_index _di_dmt_std_ids[];
+extern const size_t _di_dmt_std_ids_len;
+
+/**
+ * Find the DMT timing for an EDID standard timing 2-byte code.
+ *
+ * NULL is returned if the code doesn't match any DMT timing.
+ */
+const struct di_dmt_timing *
+_di_dmt_find_by_std_id(uint16_t edid_std_id);
 
 #endif
@@ -19,6 +19,11 @@
  * section 2.2.1.
  */
 #define EDID_MAX_BLOCK_COUNT 256
+/**
+ * The maximum number of EDID established timings I and II which are DMT
+ * timings, defined in section 3.8.
+ */
+#define EDID_MAX_ESTABLISHED_TIMING_I_II_DMT_COUNT 12
 /**
  * The maximum number of EDID standard timings, defined in section 3.9.
  */
@@ -52,6 +57,12 @@
  */
 #define EDID_MAX_DESCRIPTOR_CVT_TIMING_CODES_COUNT 4
 
+struct di_edid_standard_timing_priv {
+	struct di_edid_standard_timing base;
+	/* Resolved from the 2-byte code at parse time, NULL if not a DMT */
+	const struct di_dmt_timing *dmt;
+};
+
 struct di_edid_detailed_timing_def_priv {
 	struct di_edid_detailed_timing_def base;
 	struct di_edid_detailed_timing_analog_composite analog_composite;
@@ -76,9 +87,12 @@ struct di_edid {
 
 	struct di_edid_chromaticity_coords chromaticity_coords;
 	struct di_edid_established_timings_i_ii established_timings_i_ii;
+	/* NULL-terminated, resolved from established_timings_i_ii */
+	const struct di_dmt_timing *established_timings_i_ii_dmts[EDID_MAX_ESTABLISHED_TIMING_I_II_DMT_COUNT + 1];
+	size_t established_timings_i_ii_dmts_len;
 
 	/* NULL-terminated */
-	struct di_edid_standard_timing *standard_timings[EDID_MAX_STANDARD_TIMING_COUNT + 1];
+	struct di_edid_standard_timing_priv *standard_timings[EDID_MAX_STANDARD_TIMING_COUNT + 1];
 	size_t standard_timings_len;
 
 	/* NULL-terminated */
@@ -93,6 +107,10 @@ struct di_edid {
 	struct di_edid_ext *exts[EDID_MAX_BLOCK_COUNT];
 	size_t exts_len;
 
+	/* First CTA data block for each tag across all extensions, NULL if
+	 * none */
+	const struct di_cta_data_block *cta_data_blocks_by_tag[EDID_CTA_DATA_BLOCK_TAG_COUNT];
+
 	struct di_logger *logger;
 };
 
@@ -110,7 +128,7 @@ struct di_edid_display_descriptor {
 	/* Used for RANGE_LIMITS */
 	struct di_edid_display_range_limits_priv range_limits;
 	/* Used for STD_TIMING_IDS, NULL-terminated */
-	struct di_edid_standard_timing *standard_timings[EDID_MAX_DESCRIPTOR_STANDARD_TIMING_COUNT + 1];
+	struct di_edid_standard_timing_priv *standard_timings[EDID_MAX_DESCRIPTOR_STANDARD_TIMING_COUNT + 1];
 	size_t standard_timings_len;
 	/* Used for COLOR_POINT, NULL-terminated */
 	struct di_edid_color_point *color_points[EDID_MAX_DESCRIPTOR_COLOR_POINT_COUNT + 1];
@@ -155,4 +173,27 @@ _di_edid_destroy(struct di_edid *edid);
 struct di_edid_detailed_timing_def_priv *
 _di_edid_parse_detailed_timing_def(const uint8_t data[static EDID_BYTE_DESCRIPTOR_SIZE]);
 
+/**
+ * Check whether two EDID detailed timing definitions are identical.
+ */
+bool
+_di_edid_detailed_timing_def_equal(const struct di_edid_detailed_timing_def_priv *a,
+				   const struct di_edid_detailed_timing_def_priv *b);
+
+/**
+ * Check whether two NULL-terminated lists of EDID standard timings are
+ * identical.
+ */
+bool
+_di_edid_standard_timings_equal(struct di_edid_standard_timing_priv *const *a,
+				struct di_edid_standard_timing_priv *const *b);
+
+/**
+ * Check whether two EDID display descriptors carry the same parsed
+ * information.
+ */
+bool
+_di_edid_display_descriptor_equal(const struct di_edid_display_descriptor *a,
+				  const struct di_edid_display_descriptor *b);
+
 #endif
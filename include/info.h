@@ -5,8 +5,23 @@
  * Private header for the high-level API.
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <libdisplay-info/displayid.h>
+#include <libdisplay-info/edid.h>
 #include <libdisplay-info/info.h>
 
+/**
+ * A bucket of the mode hash table, len is zero for empty buckets.
+ */
+struct di_info_mode_bucket {
+	int32_t h_active, v_active;
+	bool interlaced;
+	uint32_t first, len;
+};
+
 /**
  * All information here is derived from low-level information contained in
  * struct di_info. These are exposed by the high-level API only.
@@ -15,6 +30,30 @@ struct di_derived_info {
 	struct di_hdr_static_metadata hdr_static_metadata;
 	struct di_color_primaries color_primaries;
 	struct di_supported_signal_colorimetry supported_signal_colorimetry;
+	uint64_t fingerprint;
+	struct di_info_vrr_range vrr_range;
+	/* Tiled display topology of the first DisplayID extension, NULL if
+	 * none */
+	const struct di_displayid_tiled_topo *tiled_topo;
+	/* Strings returned by di_info_peek_make(), di_info_peek_model() and
+	 * di_info_peek_serial() */
+	char *make, *model, *serial;
+	/* Array returned by di_info_get_modes() */
+	struct di_info_mode *modes;
+	size_t modes_len;
+	/* Hash table of the modes by resolution, see di_info_supports_mode().
+	 * Each bucket refers to a range of mode_order, which holds indices into
+	 * modes. */
+	struct di_info_mode_bucket *mode_buckets;
+	size_t mode_buckets_len; /* power of two */
+	uint32_t *mode_order;
+	/* Arrays returned by di_info_get_modes_soa(), stored one after the
+	 * other, each with modes_soa_stride entries */
+	uint32_t *modes_soa;
+	size_t modes_soa_stride;
+	/* Array returned by di_info_get_implied_modes() */
+	struct di_info_mode *implied_modes;
+	size_t implied_modes_len;
 };
 
 struct di_info {
@@ -25,4 +64,30 @@ struct di_info {
 	struct di_derived_info derived;
 };
 
+struct di_info_tile_groups {
+	/* displays_len entries */
+	struct di_info_tiled_display *displays;
+	/* NULL-terminated, pointing into displays */
+	const struct di_info_tiled_display **display_ptrs;
+	/* Storage for the tiles of all displays, grouped by display */
+	struct di_info_tile *tiles;
+};
+
+/**
+ * Merge the timings of an EDID into a sorted array of modes.
+ *
+ * Returns false on memory allocation failure.
+ */
+bool
+_di_info_derive_modes(const struct di_edid *edid, struct di_derived_info *derived);
+
+/**
+ * Convert an EDID detailed timing definition into a mode, without sources.
+ *
+ * The borders are added to the front and back porches.
+ */
+void
+_di_info_mode_from_detailed_timing_def(struct di_info_mode *m,
+				       const struct di_edid_detailed_timing_def *def);
+
 #endif
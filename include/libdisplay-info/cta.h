@@ -63,6 +63,45 @@ struct di_cta_video_format {
 const struct di_cta_video_format *
 di_cta_video_format_from_vic(uint8_t vic);
 
+struct di_dmt_timing;
+
+/**
+ * Get the DMT timing identical to a CTA-861 video format.
+ *
+ * The timings are identical if they have the same pixel clock and the same
+ * active, front porch, sync pulse and back porch sizes. DMT borders count as
+ * blanking.
+ *
+ * Returns NULL if the video format has no DMT equivalent. fmt must have been
+ * returned by this library.
+ */
+const struct di_dmt_timing *
+di_cta_video_format_get_dmt(const struct di_cta_video_format *fmt);
+
+/**
+ * Iterate over all known CTA-861 video formats, in VIC order.
+ *
+ * index must point to zero on the first call and is advanced on each call.
+ * Returns NULL once all video formats have been returned.
+ */
+const struct di_cta_video_format *
+di_cta_video_formats_iter(size_t *index);
+
+/**
+ * Find a CTA-861 video format by its resolution and field refresh rate.
+ *
+ * v_active is the number of active lines per frame, as in
+ * struct di_cta_video_format. The refresh rate is matched with a tolerance of
+ * 0.5 Hz, so that both the integer and the 1000/1001 variants of a video
+ * format match. If several video formats match, the closest one is returned.
+ *
+ * Returns NULL if no video format matches.
+ */
+const struct di_cta_video_format *
+di_cta_video_format_find(int32_t h_active, int32_t v_active,
+			 float refresh_rate_hz, bool interlaced,
+			 enum di_cta_video_format_picture_aspect_ratio picture_aspect_ratio);
+
 /**
  * EDID CTA-861 extension block.
  */
@@ -173,6 +212,21 @@ enum di_cta_data_block_tag {
 enum di_cta_data_block_tag
 di_cta_data_block_get_tag(const struct di_cta_data_block *block);
 
+/**
+ * Find the first CTA data block with the specified tag.
+ *
+ * The lookup uses an index built at parse time and doesn't walk the data
+ * blocks. Only the first data block of each tag is indexed: later instances
+ * of a tag which may appear multiple times (e.g. audio or vendor-specific
+ * data blocks) are never returned. Use di_edid_cta_get_data_blocks() to get
+ * all of them.
+ *
+ * Returns NULL if the CTA block has no such data block.
+ */
+const struct di_cta_data_block *
+di_edid_cta_find_data_block(const struct di_edid_cta *cta,
+			    enum di_cta_data_block_tag tag);
+
 /**
  * Audio formats, defined in tables 37 and 39.
  *
@@ -801,6 +855,14 @@ struct di_cta_svd {
 	uint8_t vic;
 	/* Whether this is a native video format */
 	bool native;
+	/* Video format for the VIC, NULL if the VIC is unknown */
+	const struct di_cta_video_format *video_format;
+	/* Whether YCbCr 4:2:0 sampling is supported, either from the YCbCr 4:2:0
+	 * Capability Map Data Block or from the YCbCr 4:2:0 Video Data Block */
+	bool ycbcr420;
+	/* Whether only YCbCr 4:2:0 sampling is supported, i.e. the SVD comes
+	 * from a YCbCr 4:2:0 Video Data Block */
+	bool ycbcr420_only;
 };
 
 /**
@@ -824,6 +886,15 @@ di_cta_data_block_get_svds(const struct di_cta_data_block *block);
 const struct di_cta_svd *const *
 di_cta_data_block_get_ycbcr420_svds(const struct di_cta_data_block *block);
 
+/**
+ * Get an array of short video descriptors whose VIC is unknown, from all video
+ * data blocks and YCbCr 4:2:0 video data blocks of the CTA block.
+ *
+ * The returned array is NULL-terminated.
+ */
+const struct di_cta_svd *const *
+di_edid_cta_get_unknown_svds(const struct di_edid_cta *cta);
+
 enum di_cta_vesa_transfer_characteristics_usage {
 	/* White transfer characteristic */
 	DI_CTA_VESA_TRANSFER_CHARACTERISTIC_USAGE_WHITE = 0,
@@ -1133,6 +1204,9 @@ struct di_cta_svr {
 	enum di_cta_svr_type type;
 	/* A VIC if type is DI_CTA_SVR_TYPE_VIC */
 	uint8_t vic;
+	/* Video format for the VIC if type is DI_CTA_SVR_TYPE_VIC, NULL if the
+	 * VIC is unknown */
+	const struct di_cta_video_format *video_format;
 	/* The index into DTDs in order of appearance if type is
 	 * DI_CTA_SVR_TYPE_DTD_INDEX */
 	uint8_t dtd_index;
@@ -38,4 +38,35 @@ struct di_dmt_timing {
 	bool reduced_blanking;
 };
 
+/**
+ * Find a DMT timing by its DMT ID.
+ *
+ * Returns NULL if the DMT ID is unknown.
+ */
+const struct di_dmt_timing *
+di_dmt_find_by_id(uint8_t dmt_id);
+
+/**
+ * Get the CTA-861 Video Identification Code (VIC) with timings identical to a
+ * DMT timing.
+ *
+ * If several VICs match, e.g. because they only differ in their picture aspect
+ * ratio, the lowest one is returned. Zero is returned if there is none.
+ */
+uint8_t
+di_dmt_timing_get_vic(const struct di_dmt_timing *t);
+
+/**
+ * Find a DMT timing by its resolution and refresh rate.
+ *
+ * The refresh rate is matched against the nominal field refresh rate of the
+ * DMT timings with a tolerance of 0.5 Hz, so that e.g. 59.94 Hz matches a
+ * 60 Hz timing. If several timings match, the closest one is returned.
+ *
+ * Returns NULL if no DMT timing matches.
+ */
+const struct di_dmt_timing *
+di_dmt_find(int32_t horiz_video, int32_t vert_video, float refresh_rate_hz,
+	    bool reduced_blanking);
+
 #endif
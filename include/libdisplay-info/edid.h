@@ -13,6 +13,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <libdisplay-info/cta.h>
+
 /**
  * EDID data structure.
  */
@@ -304,6 +306,17 @@ struct di_edid_established_timings_i_ii {
 const struct di_edid_established_timings_i_ii *
 di_edid_get_established_timings_i_ii(const struct di_edid *edid);
 
+/**
+ * Get the DMT timings of the supported established timings I and II.
+ *
+ * The established timings which aren't DMT timings (720x400 @ 70Hz and 88Hz,
+ * 640x480 @ 67Hz, 832x624 @ 75Hz and 1152x870 @ 75Hz) are omitted.
+ *
+ * The returned array is NULL-terminated.
+ */
+const struct di_dmt_timing *const *
+di_edid_get_established_timings_i_ii_dmts(const struct di_edid *edid);
+
 /**
  * Aspect ratio for an EDID standard timing.
  */
@@ -811,6 +824,22 @@ struct di_edid_cta;
 const struct di_edid_cta *
 di_edid_ext_get_cta(const struct di_edid_ext *ext);
 
+/**
+ * Find the first CTA data block with the specified tag in all CTA-861
+ * extension blocks of an EDID.
+ *
+ * The extension blocks are searched in order. The lookup uses an index built
+ * at parse time, which only records the first data block of each tag: later
+ * instances of a tag which may appear multiple times, in the same or in
+ * another extension block, are never returned. Use di_edid_ext_get_cta() and
+ * di_edid_cta_get_data_blocks() to get all of them.
+ *
+ * Returns NULL if the EDID has no such data block.
+ */
+const struct di_cta_data_block *
+di_edid_find_cta_data_block(const struct di_edid *edid,
+			    enum di_cta_data_block_tag tag);
+
 /* See <libdisplay-info/displayid.h> */
 struct di_displayid;
 
@@ -3,6 +3,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * libdisplay-info's high-level API.
@@ -71,6 +72,17 @@ di_info_get_failure_msg(const struct di_info *info);
 char *
 di_info_get_make(const struct di_info *info);
 
+/**
+ * Get the make of the display device, without allocating.
+ *
+ * Same as di_info_get_make(), except the string is computed once when the
+ * blob is parsed. The returned string is owned by the struct di_info passed
+ * in. It remains valid only as long as the di_info exists, and must not be
+ * freed by the caller.
+ */
+const char *
+di_info_peek_make(const struct di_info *info);
+
 /**
  * Get the model of the display device.
  *
@@ -87,6 +99,17 @@ di_info_get_make(const struct di_info *info);
 char *
 di_info_get_model(const struct di_info *info);
 
+/**
+ * Get the model of the display device, without allocating.
+ *
+ * Same as di_info_get_model(), except the string is computed once when the
+ * blob is parsed. The returned string is owned by the struct di_info passed
+ * in. It remains valid only as long as the di_info exists, and must not be
+ * freed by the caller.
+ */
+const char *
+di_info_peek_model(const struct di_info *info);
+
 /**
  * Get the serial of the display device.
  *
@@ -103,6 +126,17 @@ di_info_get_model(const struct di_info *info);
 char *
 di_info_get_serial(const struct di_info *info);
 
+/**
+ * Get the serial of the display device, without allocating.
+ *
+ * Same as di_info_get_serial(), except the string is computed once when the
+ * blob is parsed. The returned string is owned by the struct di_info passed
+ * in. It remains valid only as long as the di_info exists, and must not be
+ * freed by the caller.
+ */
+const char *
+di_info_peek_serial(const struct di_info *info);
+
 /**
  * Display HDR static metadata
  */
@@ -244,4 +278,632 @@ di_info_get_supported_signal_colorimetry(const struct di_info *info);
 float
 di_info_get_default_gamma(const struct di_info *info);
 
+/**
+ * Get a fingerprint identifying the display device.
+ *
+ * The fingerprint is a 64-bit hash of the manufacturer PNP ID, the product
+ * code, the serial number, the product serial string and the DisplayID tiled
+ * display topology identifiers. It is computed once when the blob is parsed.
+ *
+ * The fingerprint is stable across library versions and hosts: it can be used
+ * as a key to store per-display configuration. Two identical display devices
+ * which don't advertise a serial number will have the same fingerprint.
+ */
+uint64_t
+di_info_get_fingerprint(const struct di_info *info);
+
+/**
+ * Sections of display device information compared by di_info_diff().
+ */
+enum di_info_diff_section {
+	/* Vendor and product identification, product name and serial */
+	DI_INFO_DIFF_IDENTITY = 1 << 0,
+	/* Version, basic display parameters, features and chromaticity */
+	DI_INFO_DIFF_BASIC_PARAMS = 1 << 1,
+	/* Established timings I, II and III */
+	DI_INFO_DIFF_ESTABLISHED_TIMINGS = 1 << 2,
+	/* Standard timings, including standard timing identifier descriptors */
+	DI_INFO_DIFF_STANDARD_TIMINGS = 1 << 3,
+	/* Detailed timing definitions, from the base block and CTA extensions */
+	DI_INFO_DIFF_DETAILED_TIMINGS = 1 << 4,
+	/* Display range limits */
+	DI_INFO_DIFF_RANGE_LIMITS = 1 << 5,
+	/* Data strings, color points, color management data, CVT timing codes */
+	DI_INFO_DIFF_OTHER_DESCRIPTORS = 1 << 6,
+	/* Number or type of extension blocks */
+	DI_INFO_DIFF_EXTENSIONS = 1 << 7,
+	/* CTA-861 revision, flags, HDMI VRR range or data blocks */
+	DI_INFO_DIFF_CTA = 1 << 8,
+	/* HDR static metadata, as returned by di_info_get_hdr_static_metadata() */
+	DI_INFO_DIFF_HDR_STATIC_METADATA = 1 << 9,
+	/* DisplayID version, product type or data blocks */
+	DI_INFO_DIFF_DISPLAYID = 1 << 10,
+};
+
+/**
+ * Differences between two display device information structures.
+ */
+struct di_info_diff {
+	/* Bitfield of enum di_info_diff_section, zero if nothing differs */
+	uint32_t sections;
+	/* Bitfield of CTA data block tags which differ: bit N is set if the
+	 * data blocks with tag N (enum di_cta_data_block_tag) differ */
+	uint32_t cta_data_block_tags;
+	/* Bitfield of DisplayID data block tags which differ: bit N is set if
+	 * the data blocks with tag N (enum di_displayid_data_block_tag) differ */
+	uint32_t displayid_data_block_tags;
+};
+
+/**
+ * Compare two display device information structures.
+ *
+ * The parsed fields are compared directly. Data blocks with the same tag are
+ * compared in order of appearance across all extension blocks. The result is
+ * written to the struct di_info_diff passed in, all of its fields are zero
+ * if both structures carry the same information.
+ */
+void
+di_info_diff(const struct di_info *a, const struct di_info *b,
+	     struct di_info_diff *diff);
+
+/**
+ * Flat summary of the display device information.
+ *
+ * All fields are plain values, the struct can be copied and serialized as-is.
+ */
+struct di_info_summary {
+	/* Make, model and serial, see di_info_get_make(), di_info_get_model()
+	 * and di_info_get_serial(). Truncated to fit, empty if unset. */
+	char make[128];
+	char model[64];
+	char serial[64];
+
+	/* Fingerprint, see di_info_get_fingerprint() */
+	uint64_t fingerprint;
+
+	/* Physical screen size in centimeters, zero if unset */
+	int32_t screen_width_cm, screen_height_cm;
+
+	/* Default gamma, see di_info_get_default_gamma() */
+	float default_gamma;
+	/* See di_info_get_hdr_static_metadata() */
+	struct di_hdr_static_metadata hdr_static_metadata;
+	/* See di_info_get_default_color_primaries() */
+	struct di_color_primaries default_color_primaries;
+	/* See di_info_get_supported_signal_colorimetry() */
+	struct di_supported_signal_colorimetry supported_signal_colorimetry;
+
+	/* Whether the EDID specifies a preferred timing */
+	bool has_preferred_timing;
+	/* Preferred timing, zero if unset. The vertical size is given in lines
+	 * per field for interlaced timings. */
+	int32_t preferred_horiz_video, preferred_vert_video;
+	int32_t preferred_pixel_clock_hz;
+	/* Field refresh rate of the preferred timing in Hz, zero if unset. The
+	 * borders are counted as blanking, as in di_info_get_modes(). */
+	double preferred_refresh_rate_hz;
+	bool preferred_interlaced;
+
+	/* Whether the EDID contains display range limits */
+	bool has_range_limits;
+	/* Vertical and horizontal rate limits in Hz, zero if unset */
+	int32_t min_vert_rate_hz, max_vert_rate_hz;
+	int32_t min_horiz_rate_hz, max_horiz_rate_hz;
+	/* Maximum pixel clock in Hz, zero if unset */
+	int64_t max_pixel_clock_hz;
+
+	/* Whether the EDID contains CTA-861 and DisplayID extension blocks */
+	bool has_cta;
+	bool has_displayid;
+};
+
+/**
+ * Fill a flat summary of the display device information.
+ *
+ * This is equivalent to calling all of the individual getters, but doesn't
+ * allocate.
+ */
+void
+di_info_get_summary(const struct di_info *info, struct di_info_summary *summary);
+
+/**
+ * Sources a struct di_info_mode has been decoded from.
+ */
+enum di_info_mode_source {
+	/* EDID base block detailed timing definition */
+	DI_INFO_MODE_SOURCE_EDID_DETAILED = 1 << 0,
+	/* EDID standard timing with a DMT equivalent */
+	DI_INFO_MODE_SOURCE_EDID_STANDARD = 1 << 1,
+	/* EDID established timing I, II or III */
+	DI_INFO_MODE_SOURCE_EDID_ESTABLISHED = 1 << 2,
+	/* EDID CVT 3-byte timing code */
+	DI_INFO_MODE_SOURCE_EDID_CVT = 1 << 3,
+	/* CTA-861 extension block detailed timing definition */
+	DI_INFO_MODE_SOURCE_CTA_DETAILED = 1 << 4,
+	/* CTA-861 short video descriptor, from a Video Data Block or a YCbCr
+	 * 4:2:0 Video Data Block */
+	DI_INFO_MODE_SOURCE_CTA_SVD = 1 << 5,
+	/* CTA-861 short video reference, from a Video Format Preference Data
+	 * Block */
+	DI_INFO_MODE_SOURCE_CTA_SVR = 1 << 6,
+	/* DisplayID type I, II or III timing */
+	DI_INFO_MODE_SOURCE_DISPLAYID = 1 << 7,
+	/* GTF or CVT timing implied by the display range limits, see
+	 * di_info_get_implied_modes() */
+	DI_INFO_MODE_SOURCE_EDID_RANGE_LIMITS = 1 << 8,
+};
+
+/**
+ * Sync pulse polarity of a struct di_info_mode.
+ */
+enum di_info_mode_sync_polarity {
+	/* The source doesn't specify the polarity, e.g. DMT and CVT timings */
+	DI_INFO_MODE_SYNC_UNKNOWN = 0,
+	DI_INFO_MODE_SYNC_NEGATIVE,
+	DI_INFO_MODE_SYNC_POSITIVE,
+};
+
+/**
+ * A video timing supported by the display device, normalized from any of the
+ * timing sources.
+ *
+ * Borders are counted as part of the front and back porches. As in
+ * struct di_cta_video_format, the number of active lines is given per frame
+ * while the vertical front porch, sync pulse and back porch are given per
+ * field.
+ */
+struct di_info_mode {
+	/* Horizontal/vertical active pixels/lines */
+	int32_t h_active, v_active;
+	/* Horizontal/vertical front porch */
+	int32_t h_front, v_front;
+	/* Horizontal/vertical sync pulse */
+	int32_t h_sync, v_sync;
+	/* Horizontal/vertical back porch */
+	int32_t h_back, v_back;
+	/* Horizontal/vertical sync pulse polarity */
+	enum di_info_mode_sync_polarity h_sync_polarity, v_sync_polarity;
+	/* Pixel clock in Hz */
+	int64_t pixel_clock_hz;
+	/* Field refresh rate in mHz, computed from the timing */
+	int32_t refresh_mhz;
+	/* Whether this timing is interlaced */
+	bool interlaced;
+	/* Bitfield of enum di_info_mode_source */
+	uint32_t sources;
+	/* Whether this is a preferred timing */
+	bool preferred;
+	/* Lowest CTA-861 VIC this timing has been listed with, zero if none */
+	uint8_t vic;
+	/* DMT ID this timing has been listed with, zero if none */
+	uint8_t dmt_id;
+	/* Whether YCbCr 4:2:0 sampling is supported, see struct di_cta_svd */
+	bool ycbcr420;
+	/* Whether only YCbCr 4:2:0 sampling is supported */
+	bool ycbcr420_only;
+};
+
+/**
+ * Get all timings supported by the display device.
+ *
+ * The modes are merged from the base EDID detailed timing definitions,
+ * standard timings with a DMT equivalent, established timings I, II and III,
+ * CVT timing codes, CTA-861 detailed timing definitions, short video
+ * descriptors and short video references, and DisplayID type I, II and III
+ * timings. Modes which only differ by their sync polarity or their sources are
+ * merged together.
+ *
+ * Preferred modes come first, then modes are sorted by decreasing active
+ * area, width and refresh rate, progressive before interlaced. The array is
+ * computed once when the blob is parsed.
+ *
+ * The number of modes is written to len. The returned array is valid until
+ * di_info_destroy().
+ */
+const struct di_info_mode *
+di_info_get_modes(const struct di_info *info, size_t *len);
+
+/**
+ * Flags for di_info_supports_mode().
+ */
+enum di_info_mode_query_flag {
+	/* Query an interlaced mode instead of a progressive one */
+	DI_INFO_MODE_QUERY_INTERLACED = 1 << 0,
+	/* Ignore modes which are only supported with YCbCr 4:2:0 sampling */
+	DI_INFO_MODE_QUERY_NO_YCBCR420_ONLY = 1 << 1,
+};
+
+/**
+ * Check whether the display device supports a mode.
+ *
+ * The mode is looked up in the modes returned by di_info_get_modes(), via an
+ * index computed once when the blob is parsed. v_active is the number of
+ * active lines per frame, as in struct di_info_mode. The field refresh rate
+ * is matched with a tolerance of 0.5 Hz, so that both the integer and the
+ * 1000/1001 variants of a timing match. A zero refresh rate matches any
+ * refresh rate.
+ *
+ * flags is a bitfield of enum di_info_mode_query_flag.
+ */
+bool
+di_info_supports_mode(const struct di_info *info, int32_t h_active,
+		      int32_t v_active, int32_t refresh_mhz, uint32_t flags);
+
+/**
+ * A mode query for di_info_supports_modes().
+ */
+struct di_info_mode_query {
+	int32_t h_active, v_active;
+	int32_t refresh_mhz;
+	/* Bitfield of enum di_info_mode_query_flag */
+	uint32_t flags;
+};
+
+/**
+ * Check whether the display device supports several modes.
+ *
+ * This is equivalent to calling di_info_supports_mode() for each of the len
+ * queries. The results are written to the supported array, which must have
+ * len entries. The number of supported modes is returned.
+ */
+size_t
+di_info_supports_modes(const struct di_info *info,
+		       const struct di_info_mode_query *queries, size_t len,
+		       bool *supported);
+
+/**
+ * Color format used on a link, for struct di_info_link_caps.
+ */
+enum di_info_link_color_format {
+	/* RGB or YCbCr 4:4:4 */
+	DI_INFO_LINK_COLOR_FORMAT_RGB444 = 0,
+	/* YCbCr 4:2:2 */
+	DI_INFO_LINK_COLOR_FORMAT_YCBCR422,
+	/* YCbCr 4:2:0 */
+	DI_INFO_LINK_COLOR_FORMAT_YCBCR420,
+};
+
+/**
+ * Capabilities of the link between the source and the display device.
+ */
+struct di_info_link_caps {
+	/* Maximum TMDS character rate in Hz for HDMI and DVI links, zero if
+	 * unlimited or not a TMDS link */
+	int64_t max_tmds_clock_hz;
+	/* Number of DisplayPort lanes, zero if not a DisplayPort link */
+	int32_t dp_lane_count;
+	/* DisplayPort link rate per lane in Mbit/s, e.g. 8100 for HBR3. Rates
+	 * of 10000 and above use the 128b/132b channel coding, lower rates use
+	 * 8b/10b. */
+	int32_t dp_link_rate_mbps;
+	/* Bits per color component, zero means 8 */
+	int32_t bpc;
+	/* Color format */
+	enum di_info_link_color_format color_format;
+};
+
+/**
+ * Filter the modes supported by both the display device and a link.
+ *
+ * Modes are kept if the resulting TMDS character rate or DisplayPort data rate
+ * fit the link. The maximum pixel clock of the display range limits applies to
+ * the 8 bpc TMDS character rate on HDMI, and to the pixel clock on DisplayPort.
+ * In YCbCr 4:2:0, only modes listed with YCbCr 4:2:0 support are kept. In
+ * other color formats, modes which are only supported with YCbCr 4:2:0 are
+ * dropped.
+ * DisplayPort FEC and MST overhead is not accounted for.
+ *
+ * Pointers to the kept modes are written to out, in the order of
+ * di_info_get_modes(). out must have room for as many entries as returned by
+ * di_info_get_modes(). The number of kept modes is returned.
+ */
+size_t
+di_info_filter_modes(const struct di_info *info,
+		     const struct di_info_link_caps *link_caps,
+		     const struct di_info_mode **out);
+
+/**
+ * Get the timings implied by the display range limits.
+ *
+ * Displays which accept continuous frequencies (or default GTF for EDID 1.3)
+ * and whose display range limits descriptor specifies GTF, secondary GTF or
+ * CVT support accept any timing generated by the formula within the range
+ * limits. This function returns such timings for a fixed grid of common
+ * resolutions and refresh rates, generated with the display's GTF or CVT
+ * parameters and kept if they fit the vertical rate, horizontal rate, pixel
+ * clock and CVT maximum active pixels limits. Reduced blanking is used for
+ * CVT if the display supports it.
+ *
+ * The modes are sorted like di_info_get_modes() and have the
+ * DI_INFO_MODE_SOURCE_EDID_RANGE_LIMITS source. Timings which are also
+ * listed explicitly are not removed. The array is computed once when the blob
+ * is parsed.
+ *
+ * The number of modes is written to len. The returned array is valid until
+ * di_info_destroy().
+ */
+const struct di_info_mode *
+di_info_get_implied_modes(const struct di_info *info, size_t *len);
+
+/**
+ * Flags for struct di_info_mode_policy.
+ */
+enum di_info_mode_policy_flag {
+	/* Prefer modes with the resolution of the first preferred mode over
+	 * larger ones */
+	DI_INFO_MODE_POLICY_PREFER_NATIVE = 1 << 0,
+	/* Allow interlaced modes, they still rank below progressive modes
+	 * with the same resolution */
+	DI_INFO_MODE_POLICY_ALLOW_INTERLACED = 1 << 1,
+	/* Allow YCbCr 4:2:0, for modes which require it or which don't fit
+	 * the link in RGB */
+	DI_INFO_MODE_POLICY_ALLOW_YCBCR420 = 1 << 2,
+	/* Require HDR: the display must support the PQ or HLG EOTF, and the
+	 * link must carry at least 10 bits per component */
+	DI_INFO_MODE_POLICY_HDR = 1 << 3,
+};
+
+/**
+ * Policy for di_info_select_mode().
+ */
+struct di_info_mode_policy {
+	/* Bitfield of enum di_info_mode_policy_flag */
+	uint32_t flags;
+	/* Maximum pixel clock in Hz, zero if unlimited */
+	int64_t max_pixel_clock_hz;
+	/* Maximum field refresh rate in mHz, zero if unlimited */
+	int32_t max_refresh_mhz;
+	/* Link capabilities, NULL if unlimited. The color_format field is
+	 * ignored. */
+	const struct di_info_link_caps *link_caps;
+};
+
+/**
+ * Select the best mode according to a policy.
+ *
+ * Modes returned by di_info_get_modes() which don't satisfy the policy
+ * constraints are skipped, see di_info_filter_modes() for the link checks.
+ * The remaining modes are ranked by:
+ *
+ * - Native resolution, if DI_INFO_MODE_POLICY_PREFER_NATIVE is set
+ * - Active area
+ * - Refresh rate
+ * - Progressive before interlaced
+ * - RGB before YCbCr 4:2:0
+ * - Preferred modes first
+ * - Lower pixel clock
+ *
+ * If color_format is not NULL, the color format to use with the selected mode
+ * is written to it.
+ *
+ * NULL is returned if no mode satisfies the policy.
+ */
+const struct di_info_mode *
+di_info_select_mode(const struct di_info *info,
+		    const struct di_info_mode_policy *policy,
+		    enum di_info_link_color_format *color_format);
+
+/**
+ * Flags of struct di_info_modes_soa.
+ */
+enum di_info_modes_soa_flag {
+	/* See struct di_info_mode.preferred */
+	DI_INFO_MODES_SOA_PREFERRED = 1 << 0,
+	/* See struct di_info_mode.interlaced */
+	DI_INFO_MODES_SOA_INTERLACED = 1 << 1,
+	/* See struct di_info_mode.ycbcr420 */
+	DI_INFO_MODES_SOA_YCBCR420 = 1 << 2,
+	/* See struct di_info_mode.ycbcr420_only */
+	DI_INFO_MODES_SOA_YCBCR420_ONLY = 1 << 3,
+};
+
+/**
+ * The modes of a display device, as a structure of arrays.
+ *
+ * Entry i of each array describes the mode i returned by di_info_get_modes().
+ * Each array is aligned to 64 bytes and is padded with zeroes to a multiple of
+ * 16 entries, so that it can be processed with aligned vector loads without a
+ * scalar tail.
+ */
+struct di_info_modes_soa {
+	/* Number of modes */
+	size_t len;
+	/* Horizontal/vertical active pixels/lines */
+	const uint32_t *h_active, *v_active;
+	/* Pixel clock in kHz, rounded to the nearest kHz */
+	const uint32_t *pixel_clock_khz;
+	/* Field refresh rate in mHz */
+	const uint32_t *refresh_mhz;
+	/* Bitfield of enum di_info_modes_soa_flag */
+	const uint32_t *flags;
+};
+
+/**
+ * Get the modes of a display device as a structure of arrays.
+ *
+ * The arrays are computed once when the blob is parsed, and are valid until
+ * di_info_destroy().
+ */
+void
+di_info_get_modes_soa(const struct di_info *info, struct di_info_modes_soa *soa);
+
+/**
+ * Sources of a variable refresh rate range.
+ */
+enum di_info_vrr_source {
+	/* EDID display range limits descriptor, on an EDID 1.4 display which
+	 * supports continuous frequencies. This is a weak heuristic: EDID has
+	 * no adaptive-sync capability flag, and many displays which only
+	 * support fixed refresh rates advertise such range limits. */
+	DI_INFO_VRR_SOURCE_EDID_RANGE_LIMITS = 1 << 0,
+	/* VRRmin and VRRmax of the HDMI Forum Sink Capability Data Structure */
+	DI_INFO_VRR_SOURCE_HDMI = 1 << 1,
+};
+
+/**
+ * Variable refresh rate range of a display device.
+ */
+struct di_info_vrr_range {
+	/* Minimum and maximum refresh rate in Hz, zero if unset */
+	int32_t min_hz, max_hz;
+	/* Bitfield of enum di_info_vrr_source, zero if the display device
+	 * doesn't advertise variable refresh rate support */
+	uint32_t sources;
+};
+
+/**
+ * Get the variable refresh rate range of a display device.
+ *
+ * The HDMI VRRmin and VRRmax fields take precedence over the display range
+ * limits. When VRRmax is unset, the maximum vertical rate of the display range
+ * limits is used if available.
+ *
+ * A range which only comes from DI_INFO_VRR_SOURCE_EDID_RANGE_LIMITS doesn't
+ * guarantee that the display device supports variable refresh rates. Callers
+ * should additionally check the link (e.g. DisplayPort adaptive-sync) before
+ * enabling VRR.
+ *
+ * The returned pointer is owned by the struct di_info passed in. It remains
+ * valid only as long as the di_info exists, and must not be freed by the
+ * caller.
+ *
+ * This function does not return NULL. When the display device doesn't
+ * advertise variable refresh rate support, all fields are zero.
+ */
+const struct di_info_vrr_range *
+di_info_get_vrr_range(const struct di_info *info);
+
+/**
+ * A tile of a tiled display, see di_info_group_tiles().
+ */
+struct di_info_tile {
+	/* Display device driving the tile */
+	const struct di_info *info;
+	/* Horizontal/vertical tile location, starting from zero */
+	int32_t horiz_tile_location, vert_tile_location;
+	/* Horizontal/vertical offset of the tile in the tiled display, in
+	 * pixels/lines */
+	int32_t x, y;
+	/* Horizontal/vertical size of the tile in pixels/lines */
+	int32_t width, height;
+};
+
+/**
+ * A tiled display, made of the display devices which share the same tiled
+ * display topology vendor ID, product code and serial number.
+ */
+struct di_info_tiled_display {
+	/* Vendor PnP ID, product code and serial number of the tiled
+	 * display */
+	char vendor_id[3];
+	uint16_t product_code;
+	uint32_t serial_number;
+	/* Total number of horizontal/vertical tiles */
+	int32_t total_horiz_tiles, total_vert_tiles;
+
+	/* Tiles, in the order of the display devices passed to
+	 * di_info_group_tiles() */
+	const struct di_info_tile *tiles;
+	size_t tiles_len;
+	/* True if each tile location is covered by exactly one tile */
+	bool complete;
+
+	/* Combined mode: size of the whole tiled display in pixels/lines, and
+	 * highest refresh rate in mHz of a progressive mode supported by all
+	 * tiles at their tile size, zero if none */
+	int32_t width, height;
+	int32_t refresh_mhz;
+};
+
+/**
+ * Tiled displays assembled from several display devices.
+ */
+struct di_info_tile_groups;
+
+/**
+ * Group display devices into tiled displays.
+ *
+ * Display devices are grouped according to the DisplayID Tiled Display
+ * Topology Data Block. Display devices without one are ignored. Tile offsets
+ * and the combined size assume that all tiles have the same size.
+ *
+ * The returned object references the struct di_info passed in, which must
+ * outlive it. It must be destroyed with di_info_tile_groups_destroy().
+ *
+ * NULL is returned on memory allocation failure.
+ */
+struct di_info_tile_groups *
+di_info_group_tiles(const struct di_info *const *infos, size_t infos_len);
+
+/**
+ * Destroy tiled displays returned by di_info_group_tiles().
+ */
+void
+di_info_tile_groups_destroy(struct di_info_tile_groups *groups);
+
+/**
+ * Get the tiled displays, in the order of their first display device.
+ *
+ * The returned array is NULL-terminated.
+ */
+const struct di_info_tiled_display *const *
+di_info_tile_groups_get_displays(const struct di_info_tile_groups *groups);
+
+/**
+ * Flags of struct di_info_drm_mode, same values as DRM_MODE_FLAG_*.
+ */
+enum di_info_drm_mode_flag {
+	DI_INFO_DRM_MODE_FLAG_PHSYNC = 1 << 0,
+	DI_INFO_DRM_MODE_FLAG_NHSYNC = 1 << 1,
+	DI_INFO_DRM_MODE_FLAG_PVSYNC = 1 << 2,
+	DI_INFO_DRM_MODE_FLAG_NVSYNC = 1 << 3,
+	DI_INFO_DRM_MODE_FLAG_INTERLACE = 1 << 4,
+};
+
+/**
+ * Types of struct di_info_drm_mode, same values as DRM_MODE_TYPE_*.
+ */
+enum di_info_drm_mode_type {
+	DI_INFO_DRM_MODE_TYPE_PREFERRED = 1 << 3,
+	DI_INFO_DRM_MODE_TYPE_DRIVER = 1 << 6,
+};
+
+/**
+ * A mode with the same layout as drmModeModeInfo from libdrm and struct
+ * drm_mode_modeinfo from the kernel UAPI.
+ *
+ * Vertical fields are given in lines per frame, interlaced modes follow the
+ * DRM convention of an odd vtotal.
+ */
+struct di_info_drm_mode {
+	/* Pixel clock in kHz */
+	uint32_t clock;
+	uint16_t hdisplay, hsync_start, hsync_end, htotal, hskew;
+	uint16_t vdisplay, vsync_start, vsync_end, vtotal, vscan;
+	/* Field refresh rate in Hz, rounded to the nearest integer */
+	uint32_t vrefresh;
+	/* Bitfield of enum di_info_drm_mode_flag */
+	uint32_t flags;
+	/* Bitfield of enum di_info_drm_mode_type */
+	uint32_t type;
+	/* NUL-terminated name, such as "1920x1080" or "1920x1080i" */
+	char name[32];
+};
+
+/**
+ * Write the modes of a display device as DRM modes.
+ *
+ * The modes returned by di_info_get_modes() are converted in order and written
+ * to the caller-provided modes array, up to modes_len entries. Modes which
+ * don't fit the 16-bit DRM timing fields are skipped. Sync polarity flags are
+ * left unset when the polarity is unknown. All modes have the DRIVER type,
+ * preferred modes also have the PREFERRED type.
+ *
+ * This function doesn't allocate. Returns the number of modes written, which
+ * is at most the number of modes returned by di_info_get_modes().
+ */
+size_t
+di_info_get_drm_modes(const struct di_info *info,
+		      struct di_info_drm_mode *modes, size_t modes_len);
+
 #endif
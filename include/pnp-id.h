@@ -0,0 +1,20 @@
+#ifndef PNP_ID_H
+#define PNP_ID_H
+
+/**
+ * Private header for the PNP ID database.
+ */
+
+/**
+ * Get the manufacturer name for a 3-character PNP ID.
+ *
+ * The table generated at build-time is looked up first. If the runtime-pnp-ids
+ * build option is enabled, IDs missing from it are then looked up in the
+ * system pnp.ids file, which is loaded on first use.
+ *
+ * Returns NULL if the PNP ID is unknown.
+ */
+const char *
+_di_pnp_id_lookup(const char *pnp_id);
+
+#endif
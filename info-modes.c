@@ -0,0 +1,1424 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libdisplay-info/cta.h>
+#include <libdisplay-info/cvt.h>
+#include <libdisplay-info/displayid.h>
+#include <libdisplay-info/dmt.h>
+#include <libdisplay-info/edid.h>
+#include <libdisplay-info/gtf.h>
+
+#include "info.h"
+
+struct mode_list {
+	struct di_info_mode *modes;
+	size_t len, cap;
+	bool failed;
+};
+
+static int32_t
+mode_refresh_mhz(const struct di_info_mode *m)
+{
+	int64_t h_total, v_total_x2;
+
+	h_total = m->h_active + m->h_front + m->h_sync + m->h_back;
+	/* Twice the number of lines per field, interlaced fields have an
+	 * extra half line */
+	v_total_x2 = 2 * (m->v_front + m->v_sync + m->v_back);
+	if (m->interlaced)
+		v_total_x2 += m->v_active + 1;
+	else
+		v_total_x2 += 2 * m->v_active;
+
+	return (int32_t) ((m->pixel_clock_hz * 2000 + h_total * v_total_x2 / 2) /
+			  (h_total * v_total_x2));
+}
+
+static void
+add_mode(struct mode_list *list, struct di_info_mode *m)
+{
+	struct di_info_mode *modes;
+	size_t cap;
+
+	if (m->h_active <= 0 || m->v_active <= 0 || m->pixel_clock_hz <= 0 ||
+	    m->h_front < 0 || m->h_sync < 0 || m->h_back < 0 ||
+	    m->v_front < 0 || m->v_sync < 0 || m->v_back < 0)
+		return;
+
+	if (list->len == list->cap) {
+		cap = list->cap == 0 ? 32 : 2 * list->cap;
+		modes = realloc(list->modes, cap * sizeof(modes[0]));
+		if (!modes) {
+			list->failed = true;
+			return;
+		}
+		list->modes = modes;
+		list->cap = cap;
+	}
+
+	m->refresh_mhz = mode_refresh_mhz(m);
+	list->modes[list->len++] = *m;
+}
+
+static enum di_info_mode_sync_polarity
+detailed_timing_def_polarity(enum di_edid_detailed_timing_def_sync_polarity pol)
+{
+	switch (pol) {
+	case DI_EDID_DETAILED_TIMING_DEF_SYNC_NEGATIVE:
+		return DI_INFO_MODE_SYNC_NEGATIVE;
+	case DI_EDID_DETAILED_TIMING_DEF_SYNC_POSITIVE:
+		return DI_INFO_MODE_SYNC_POSITIVE;
+	}
+	return DI_INFO_MODE_SYNC_UNKNOWN;
+}
+
+void
+_di_info_mode_from_detailed_timing_def(struct di_info_mode *m,
+				       const struct di_edid_detailed_timing_def *def)
+{
+	memset(m, 0, sizeof(*m));
+
+	m->h_active = def->horiz_video;
+	m->h_front = def->horiz_front_porch + def->horiz_border;
+	m->h_sync = def->horiz_sync_pulse;
+	m->h_back = def->horiz_blank - def->horiz_front_porch -
+		    def->horiz_sync_pulse + def->horiz_border;
+	/* The vertical size is given per field for interlaced timings */
+	m->v_active = def->interlaced ? 2 * def->vert_video : def->vert_video;
+	m->v_front = def->vert_front_porch + def->vert_border;
+	m->v_sync = def->vert_sync_pulse;
+	m->v_back = def->vert_blank - def->vert_front_porch -
+		    def->vert_sync_pulse + def->vert_border;
+	m->pixel_clock_hz = def->pixel_clock_hz;
+	m->interlaced = def->interlaced;
+
+	switch (def->signal_type) {
+	case DI_EDID_DETAILED_TIMING_DEF_SIGNAL_DIGITAL_SEPARATE:
+		m->h_sync_polarity = detailed_timing_def_polarity(def->digital_separate->sync_horiz_polarity);
+		m->v_sync_polarity = detailed_timing_def_polarity(def->digital_separate->sync_vert_polarity);
+		break;
+	case DI_EDID_DETAILED_TIMING_DEF_SIGNAL_DIGITAL_COMPOSITE:
+		m->h_sync_polarity = detailed_timing_def_polarity(def->digital_composite->sync_horiz_polarity);
+		break;
+	default:
+		break;
+	}
+
+	if (m->h_active > 0 && m->v_active > 0)
+		m->refresh_mhz = mode_refresh_mhz(m);
+}
+
+static void
+add_detailed_timing_def(struct mode_list *list,
+			const struct di_edid_detailed_timing_def *def,
+			uint32_t source, bool preferred)
+{
+	struct di_info_mode m;
+
+	_di_info_mode_from_detailed_timing_def(&m, def);
+	m.sources = source;
+	m.preferred = preferred;
+
+	add_mode(list, &m);
+}
+
+static void
+add_dmt_timing(struct mode_list *list, const struct di_dmt_timing *t,
+	       uint32_t source)
+{
+	struct di_info_mode m = {0};
+
+	/* DMT borders are part of the blanking on the wire */
+	m.h_active = t->horiz_video;
+	m.h_front = t->horiz_front_porch + t->horiz_border;
+	m.h_sync = t->horiz_sync_pulse;
+	m.h_back = t->horiz_blank - t->horiz_front_porch -
+		   t->horiz_sync_pulse + t->horiz_border;
+	m.v_active = t->vert_video;
+	m.v_front = t->vert_front_porch + t->vert_border;
+	m.v_sync = t->vert_sync_pulse;
+	m.v_back = t->vert_blank - t->vert_front_porch -
+		   t->vert_sync_pulse + t->vert_border;
+	m.pixel_clock_hz = t->pixel_clock_hz;
+	m.sources = source;
+	m.dmt_id = t->dmt_id;
+	m.vic = di_dmt_timing_get_vic(t);
+
+	add_mode(list, &m);
+}
+
+static enum di_info_mode_sync_polarity
+video_format_polarity(enum di_cta_video_format_sync_polarity pol)
+{
+	switch (pol) {
+	case DI_CTA_VIDEO_FORMAT_SYNC_NEGATIVE:
+		return DI_INFO_MODE_SYNC_NEGATIVE;
+	case DI_CTA_VIDEO_FORMAT_SYNC_POSITIVE:
+		return DI_INFO_MODE_SYNC_POSITIVE;
+	}
+	return DI_INFO_MODE_SYNC_UNKNOWN;
+}
+
+static void
+add_video_format(struct mode_list *list, const struct di_cta_video_format *fmt,
+		 uint32_t source, bool ycbcr420, bool ycbcr420_only)
+{
+	struct di_info_mode m = {0};
+	const struct di_dmt_timing *dmt;
+
+	m.h_active = fmt->h_active;
+	m.h_front = fmt->h_front;
+	m.h_sync = fmt->h_sync;
+	m.h_back = fmt->h_back;
+	m.v_active = fmt->v_active;
+	m.v_front = fmt->v_front;
+	m.v_sync = fmt->v_sync;
+	m.v_back = fmt->v_back;
+	m.h_sync_polarity = video_format_polarity(fmt->h_sync_polarity);
+	m.v_sync_polarity = video_format_polarity(fmt->v_sync_polarity);
+	m.pixel_clock_hz = fmt->pixel_clock_hz;
+	m.interlaced = fmt->interlaced;
+	m.sources = source;
+	m.vic = fmt->vic;
+	m.ycbcr420 = ycbcr420;
+	m.ycbcr420_only = ycbcr420_only;
+
+	dmt = di_cta_video_format_get_dmt(fmt);
+	if (dmt)
+		m.dmt_id = dmt->dmt_id;
+
+	add_mode(list, &m);
+}
+
+static void
+add_cvt_timing(struct mode_list *list, const struct di_cvt_options *options,
+	       uint32_t source, bool preferred)
+{
+	struct di_cvt_timing t;
+	struct di_info_mode m = {0};
+
+	di_cvt_compute(&t, options);
+
+	m.h_active = (int32_t) t.total_active_pixels;
+	m.h_front = (int32_t) t.h_front_porch;
+	m.h_sync = (int32_t) t.h_sync;
+	m.h_back = (int32_t) t.h_back_porch;
+	/* v_lines_rnd is the number of lines per field */
+	m.v_active = (int32_t) t.v_lines_rnd;
+	if (options->int_rqd)
+		m.v_active *= 2;
+	m.v_front = (int32_t) t.v_front_porch;
+	m.v_sync = (int32_t) t.v_sync;
+	m.v_back = (int32_t) t.v_back_porch;
+	m.pixel_clock_hz = llround(t.act_pixel_freq * 1000 * 1000);
+	m.interlaced = options->int_rqd;
+	m.sources = source;
+	m.preferred = preferred;
+
+	add_mode(list, &m);
+}
+
+static void
+add_cvt_timing_code(struct mode_list *list, const struct di_edid_cvt_timing_code *t)
+{
+	struct di_cvt_options options = {0};
+	int32_t hratio, vratio;
+
+	switch (t->aspect_ratio) {
+	case DI_EDID_CVT_TIMING_CODE_4_3:
+		hratio = 4;
+		vratio = 3;
+		break;
+	case DI_EDID_CVT_TIMING_CODE_16_9:
+		hratio = 16;
+		vratio = 9;
+		break;
+	case DI_EDID_CVT_TIMING_CODE_16_10:
+		hratio = 16;
+		vratio = 10;
+		break;
+	case DI_EDID_CVT_TIMING_CODE_15_9:
+		hratio = 15;
+		vratio = 9;
+		break;
+	default:
+		return;
+	}
+
+	options.v_lines = t->addressable_lines_per_field;
+	options.h_pixels = 8 * (((options.v_lines * hratio) / vratio) / 8);
+
+	options.red_blank_ver = DI_CVT_REDUCED_BLANKING_NONE;
+	if (t->supports_50hz_sb) {
+		options.ip_freq_rqd = 50;
+		add_cvt_timing(list, &options, DI_INFO_MODE_SOURCE_EDID_CVT, false);
+	}
+	if (t->supports_60hz_sb) {
+		options.ip_freq_rqd = 60;
+		add_cvt_timing(list, &options, DI_INFO_MODE_SOURCE_EDID_CVT, false);
+	}
+	if (t->supports_75hz_sb) {
+		options.ip_freq_rqd = 75;
+		add_cvt_timing(list, &options, DI_INFO_MODE_SOURCE_EDID_CVT, false);
+	}
+	if (t->supports_85hz_sb) {
+		options.ip_freq_rqd = 85;
+		add_cvt_timing(list, &options, DI_INFO_MODE_SOURCE_EDID_CVT, false);
+	}
+	if (t->supports_60hz_rb) {
+		options.ip_freq_rqd = 60;
+		options.red_blank_ver = DI_CVT_REDUCED_BLANKING_V1;
+		add_cvt_timing(list, &options, DI_INFO_MODE_SOURCE_EDID_CVT, false);
+	}
+}
+
+static void
+add_displayid_type_i_ii_timing(struct mode_list *list,
+			       const struct di_displayid_type_i_ii_vii_timing *t)
+{
+	struct di_info_mode m = {0};
+
+	m.h_active = t->horiz_active;
+	m.h_front = t->horiz_offset;
+	m.h_sync = t->horiz_sync_width;
+	m.h_back = t->horiz_blank - t->horiz_offset - t->horiz_sync_width;
+	m.v_active = t->interlaced ? 2 * t->vert_active : t->vert_active;
+	m.v_front = t->vert_offset;
+	m.v_sync = t->vert_sync_width;
+	m.v_back = t->vert_blank - t->vert_offset - t->vert_sync_width;
+	m.h_sync_polarity = t->horiz_sync_polarity == DI_DISPLAYID_TYPE_I_II_VII_TIMING_SYNC_POSITIVE
+			    ? DI_INFO_MODE_SYNC_POSITIVE : DI_INFO_MODE_SYNC_NEGATIVE;
+	m.v_sync_polarity = t->vert_sync_polarity == DI_DISPLAYID_TYPE_I_II_VII_TIMING_SYNC_POSITIVE
+			    ? DI_INFO_MODE_SYNC_POSITIVE : DI_INFO_MODE_SYNC_NEGATIVE;
+	m.pixel_clock_hz = llround(t->pixel_clock_mhz * 1000 * 1000);
+	m.interlaced = t->interlaced;
+	m.sources = DI_INFO_MODE_SOURCE_DISPLAYID;
+	m.preferred = t->preferred;
+
+	add_mode(list, &m);
+}
+
+static void
+add_displayid_type_iii_timing(struct mode_list *list,
+			      const struct di_displayid_type_iii_timing *t)
+{
+	struct di_cvt_options options = {0};
+	int32_t hratio, vratio;
+
+	switch (t->aspect_ratio) {
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_1_1:
+		hratio = vratio = 1;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_5_4:
+		hratio = 5;
+		vratio = 4;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_4_3:
+		hratio = 4;
+		vratio = 3;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_15_9:
+		hratio = 15;
+		vratio = 9;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_16_9:
+		hratio = 16;
+		vratio = 9;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_16_10:
+		hratio = 16;
+		vratio = 10;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_64_27:
+		hratio = 64;
+		vratio = 27;
+		break;
+	case DI_DISPLAYID_TIMING_ASPECT_RATIO_256_135:
+		hratio = 256;
+		vratio = 135;
+		break;
+	default:
+		return;
+	}
+
+	switch (t->algo) {
+	case DI_DISPLAYID_TYPE_III_TIMING_CVT_STANDARD_BLANKING:
+		options.red_blank_ver = DI_CVT_REDUCED_BLANKING_NONE;
+		break;
+	case DI_DISPLAYID_TYPE_III_TIMING_CVT_REDUCED_BLANKING:
+		options.red_blank_ver = DI_CVT_REDUCED_BLANKING_V1;
+		break;
+	}
+
+	options.h_pixels = t->horiz_active;
+	options.v_lines = (t->horiz_active * vratio) / hratio;
+	options.ip_freq_rqd = t->refresh_rate_hz;
+	options.int_rqd = t->interlaced;
+
+	add_cvt_timing(list, &options, DI_INFO_MODE_SOURCE_DISPLAYID, t->preferred);
+}
+
+static void
+add_dmt_timings(struct mode_list *list, const struct di_dmt_timing *const *dmts,
+		uint32_t source)
+{
+	size_t i;
+
+	for (i = 0; dmts[i] != NULL; i++)
+		add_dmt_timing(list, dmts[i], source);
+}
+
+static void
+add_standard_timings(struct mode_list *list,
+		     const struct di_edid_standard_timing *const *timings)
+{
+	const struct di_dmt_timing *dmt;
+	size_t i;
+
+	for (i = 0; timings[i] != NULL; i++) {
+		dmt = di_edid_standard_timing_get_dmt(timings[i]);
+		if (dmt)
+			add_dmt_timing(list, dmt, DI_INFO_MODE_SOURCE_EDID_STANDARD);
+	}
+}
+
+static void
+add_svds(struct mode_list *list, const struct di_cta_svd *const *svds)
+{
+	size_t i;
+
+	for (i = 0; svds[i] != NULL; i++) {
+		if (svds[i]->video_format)
+			add_video_format(list, svds[i]->video_format,
+					 DI_INFO_MODE_SOURCE_CTA_SVD,
+					 svds[i]->ycbcr420, svds[i]->ycbcr420_only);
+	}
+}
+
+/**
+ * Get a DTD by its index in order of appearance, first in the base block and
+ * then in the CTA-861 extension blocks. This is what SVRs refer to.
+ */
+static const struct di_edid_detailed_timing_def *
+get_detailed_timing_def(const struct di_edid *edid, size_t index)
+{
+	const struct di_edid_detailed_timing_def *const *defs;
+	const struct di_edid_ext *const *exts;
+	const struct di_edid_cta *cta;
+	size_t i;
+
+	defs = di_edid_get_detailed_timing_defs(edid);
+	for (i = 0; defs[i] != NULL; i++) {
+		if (index-- == 0)
+			return defs[i];
+	}
+
+	exts = di_edid_get_extensions(edid);
+	for (; *exts != NULL; exts++) {
+		cta = di_edid_ext_get_cta(*exts);
+		if (!cta)
+			continue;
+		defs = di_edid_cta_get_detailed_timing_defs(cta);
+		for (i = 0; defs[i] != NULL; i++) {
+			if (index-- == 0)
+				return defs[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Find the SVD listing a VIC, to get its YCbCr 4:2:0 support.
+ */
+static const struct di_cta_svd *
+find_svd(const struct di_edid_cta *cta, uint8_t vic)
+{
+	const struct di_cta_data_block *const *blocks;
+	const struct di_cta_svd *const *svds;
+	size_t i, j;
+
+	blocks = di_edid_cta_get_data_blocks(cta);
+	for (i = 0; blocks[i] != NULL; i++) {
+		svds = di_cta_data_block_get_svds(blocks[i]);
+		if (!svds)
+			svds = di_cta_data_block_get_ycbcr420_svds(blocks[i]);
+		if (!svds)
+			continue;
+		for (j = 0; svds[j] != NULL; j++) {
+			if (svds[j]->vic == vic)
+				return svds[j];
+		}
+	}
+
+	return NULL;
+}
+
+static void
+add_svrs(struct mode_list *list, const struct di_edid *edid,
+	 const struct di_edid_cta *cta, const struct di_cta_svr *const *svrs)
+{
+	const struct di_edid_detailed_timing_def *def;
+	const struct di_cta_svd *svd;
+	size_t i;
+
+	for (i = 0; svrs[i] != NULL; i++) {
+		switch (svrs[i]->type) {
+		case DI_CTA_SVR_TYPE_VIC:
+			if (!svrs[i]->video_format)
+				break;
+			svd = find_svd(cta, svrs[i]->vic);
+			add_video_format(list, svrs[i]->video_format,
+					 DI_INFO_MODE_SOURCE_CTA_SVR,
+					 svd && svd->ycbcr420,
+					 svd && svd->ycbcr420_only);
+			break;
+		case DI_CTA_SVR_TYPE_DTD_INDEX:
+			def = get_detailed_timing_def(edid, svrs[i]->dtd_index);
+			if (def)
+				add_detailed_timing_def(list, def,
+							DI_INFO_MODE_SOURCE_CTA_SVR,
+							false);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static void
+add_display_descriptors(struct mode_list *list, const struct di_edid *edid)
+{
+	const struct di_edid_display_descriptor *const *desc;
+	const struct di_edid_cvt_timing_code *const *cvt_codes;
+	size_t i, j;
+
+	desc = di_edid_get_display_descriptors(edid);
+	for (i = 0; desc[i] != NULL; i++) {
+		switch (di_edid_display_descriptor_get_tag(desc[i])) {
+		case DI_EDID_DISPLAY_DESCRIPTOR_STD_TIMING_IDS:
+			add_standard_timings(list, di_edid_display_descriptor_get_standard_timings(desc[i]));
+			break;
+		case DI_EDID_DISPLAY_DESCRIPTOR_ESTABLISHED_TIMINGS_III:
+			add_dmt_timings(list, di_edid_display_descriptor_get_established_timings_iii(desc[i]),
+					DI_INFO_MODE_SOURCE_EDID_ESTABLISHED);
+			break;
+		case DI_EDID_DISPLAY_DESCRIPTOR_CVT_TIMING_CODES:
+			cvt_codes = di_edid_display_descriptor_get_cvt_timing_codes(desc[i]);
+			for (j = 0; cvt_codes[j] != NULL; j++)
+				add_cvt_timing_code(list, cvt_codes[j]);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static void
+add_cta(struct mode_list *list, const struct di_edid *edid,
+	const struct di_edid_cta *cta)
+{
+	const struct di_edid_detailed_timing_def *const *defs;
+	const struct di_cta_data_block *const *blocks;
+	size_t i;
+
+	defs = di_edid_cta_get_detailed_timing_defs(cta);
+	for (i = 0; defs[i] != NULL; i++)
+		add_detailed_timing_def(list, defs[i],
+					DI_INFO_MODE_SOURCE_CTA_DETAILED, false);
+
+	blocks = di_edid_cta_get_data_blocks(cta);
+	for (i = 0; blocks[i] != NULL; i++) {
+		switch (di_cta_data_block_get_tag(blocks[i])) {
+		case DI_CTA_DATA_BLOCK_VIDEO:
+			add_svds(list, di_cta_data_block_get_svds(blocks[i]));
+			break;
+		case DI_CTA_DATA_BLOCK_YCBCR420:
+			add_svds(list, di_cta_data_block_get_ycbcr420_svds(blocks[i]));
+			break;
+		case DI_CTA_DATA_BLOCK_VIDEO_FORMAT_PREF:
+			add_svrs(list, edid, cta, di_cta_data_block_get_svrs(blocks[i]));
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static void
+add_displayid(struct mode_list *list, const struct di_displayid *displayid)
+{
+	const struct di_displayid_data_block *const *blocks;
+	const struct di_displayid_type_i_ii_vii_timing *const *timings;
+	const struct di_displayid_type_iii_timing *const *type_iii_timings;
+	size_t i, j;
+
+	blocks = di_displayid_get_data_blocks(displayid);
+	for (i = 0; blocks[i] != NULL; i++) {
+		switch (di_displayid_data_block_get_tag(blocks[i])) {
+		case DI_DISPLAYID_DATA_BLOCK_TYPE_I_TIMING:
+			timings = di_displayid_data_block_get_type_i_timings(blocks[i]);
+			for (j = 0; timings[j] != NULL; j++)
+				add_displayid_type_i_ii_timing(list, timings[j]);
+			break;
+		case DI_DISPLAYID_DATA_BLOCK_TYPE_II_TIMING:
+			timings = di_displayid_data_block_get_type_ii_timings(blocks[i]);
+			for (j = 0; timings[j] != NULL; j++)
+				add_displayid_type_i_ii_timing(list, timings[j]);
+			break;
+		case DI_DISPLAYID_DATA_BLOCK_TYPE_III_TIMING:
+			type_iii_timings = di_displayid_data_block_get_type_iii_timings(blocks[i]);
+			for (j = 0; type_iii_timings[j] != NULL; j++)
+				add_displayid_type_iii_timing(list, type_iii_timings[j]);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static int
+compare_int64(int64_t a, int64_t b)
+{
+	if (a < b)
+		return -1;
+	return a > b;
+}
+
+/**
+ * Order modes by decreasing size and refresh rate, progressive first. Modes
+ * which compare equal have the same timing.
+ */
+static int
+compare_mode_timings(const struct di_info_mode *a, const struct di_info_mode *b)
+{
+	int cmp;
+
+	if ((cmp = compare_int64((int64_t) b->h_active * b->v_active,
+				 (int64_t) a->h_active * a->v_active)) != 0 ||
+	    (cmp = compare_int64(b->h_active, a->h_active)) != 0 ||
+	    (cmp = compare_int64(b->refresh_mhz, a->refresh_mhz)) != 0 ||
+	    (cmp = compare_int64(a->interlaced, b->interlaced)) != 0 ||
+	    (cmp = compare_int64(b->pixel_clock_hz, a->pixel_clock_hz)) != 0 ||
+	    (cmp = compare_int64(a->h_front, b->h_front)) != 0 ||
+	    (cmp = compare_int64(a->h_sync, b->h_sync)) != 0 ||
+	    (cmp = compare_int64(a->h_back, b->h_back)) != 0 ||
+	    (cmp = compare_int64(a->v_front, b->v_front)) != 0 ||
+	    (cmp = compare_int64(a->v_sync, b->v_sync)) != 0 ||
+	    (cmp = compare_int64(a->v_back, b->v_back)) != 0)
+		return cmp;
+	return 0;
+}
+
+static int
+mode_timing_compare(const void *a_ptr, const void *b_ptr)
+{
+	return compare_mode_timings(a_ptr, b_ptr);
+}
+
+static int
+mode_compare(const void *a_ptr, const void *b_ptr)
+{
+	const struct di_info_mode *a = a_ptr, *b = b_ptr;
+
+	if (a->preferred != b->preferred)
+		return a->preferred ? -1 : 1;
+	return compare_mode_timings(a, b);
+}
+
+static void
+merge_mode(struct di_info_mode *dst, const struct di_info_mode *src)
+{
+	if (dst->h_sync_polarity == DI_INFO_MODE_SYNC_UNKNOWN)
+		dst->h_sync_polarity = src->h_sync_polarity;
+	if (dst->v_sync_polarity == DI_INFO_MODE_SYNC_UNKNOWN)
+		dst->v_sync_polarity = src->v_sync_polarity;
+	if (src->vic != 0 && (dst->vic == 0 || src->vic < dst->vic))
+		dst->vic = src->vic;
+	if (dst->dmt_id == 0)
+		dst->dmt_id = src->dmt_id;
+
+	/* The timing is only restricted to YCbCr 4:2:0 if all of its sources
+	 * say so */
+	dst->ycbcr420_only = dst->ycbcr420_only && src->ycbcr420_only;
+	dst->ycbcr420 = dst->ycbcr420 || src->ycbcr420;
+
+	dst->sources |= src->sources;
+	dst->preferred = dst->preferred || src->preferred;
+}
+
+static size_t
+mode_bucket_hash(int32_t h_active, int32_t v_active, bool interlaced)
+{
+	uint32_t hash;
+
+	hash = (uint32_t) h_active * 0x9E3779B1u;
+	hash ^= ((uint32_t) v_active << 1 | interlaced) * 0x85EBCA77u;
+	hash ^= hash >> 15;
+	return hash;
+}
+
+/**
+ * Find the bucket for a resolution: either the bucket holding it, or the
+ * empty bucket it would be inserted in.
+ */
+static struct di_info_mode_bucket *
+find_mode_bucket(struct di_info_mode_bucket *buckets, size_t buckets_len,
+		 int32_t h_active, int32_t v_active, bool interlaced)
+{
+	struct di_info_mode_bucket *b;
+	size_t i;
+
+	/* Linear probing, the table is never more than half full */
+	i = mode_bucket_hash(h_active, v_active, interlaced);
+	while (true) {
+		b = &buckets[i & (buckets_len - 1)];
+		if (b->len == 0 || (b->h_active == h_active &&
+				    b->v_active == v_active &&
+				    b->interlaced == interlaced))
+			return b;
+		i++;
+	}
+}
+
+static bool
+build_mode_index(struct di_derived_info *derived)
+{
+	struct di_info_mode_bucket *buckets, *b;
+	const struct di_info_mode *m;
+	uint32_t *order, first;
+	size_t buckets_len, i;
+
+	buckets_len = 8;
+	while (buckets_len < 2 * derived->modes_len)
+		buckets_len *= 2;
+
+	buckets = calloc(buckets_len, sizeof(buckets[0]));
+	order = calloc(derived->modes_len + 1, sizeof(order[0]));
+	if (!buckets || !order) {
+		free(buckets);
+		free(order);
+		return false;
+	}
+
+	for (i = 0; i < derived->modes_len; i++) {
+		m = &derived->modes[i];
+		b = find_mode_bucket(buckets, buckets_len,
+				     m->h_active, m->v_active, m->interlaced);
+		b->h_active = m->h_active;
+		b->v_active = m->v_active;
+		b->interlaced = m->interlaced;
+		b->len++;
+	}
+
+	/* Point each bucket past the end of its range, then fill the ranges
+	 * backwards so that they keep the order of the modes */
+	first = 0;
+	for (i = 0; i < buckets_len; i++) {
+		first += buckets[i].len;
+		buckets[i].first = first;
+	}
+	for (i = derived->modes_len; i-- > 0;) {
+		m = &derived->modes[i];
+		b = find_mode_bucket(buckets, buckets_len,
+				     m->h_active, m->v_active, m->interlaced);
+		order[--b->first] = (uint32_t) i;
+	}
+
+	derived->mode_buckets = buckets;
+	derived->mode_buckets_len = buckets_len;
+	derived->mode_order = order;
+	return true;
+}
+
+/* Alignment of the di_info_get_modes_soa() arrays, in bytes */
+#define MODES_SOA_ALIGN 64
+#define MODES_SOA_ALIGN_LEN (MODES_SOA_ALIGN / sizeof(uint32_t))
+
+enum modes_soa_array {
+	MODES_SOA_H_ACTIVE,
+	MODES_SOA_V_ACTIVE,
+	MODES_SOA_PIXEL_CLOCK_KHZ,
+	MODES_SOA_REFRESH_MHZ,
+	MODES_SOA_FLAGS,
+	MODES_SOA_ARRAYS_LEN,
+};
+
+static bool
+build_modes_soa(struct di_derived_info *derived)
+{
+	const struct di_info_mode *m;
+	uint32_t *soa, flags;
+	size_t stride, size, i;
+
+	/* Pad each array to a whole number of aligned blocks, keep at least
+	 * one so that the arrays are never NULL */
+	stride = (derived->modes_len + MODES_SOA_ALIGN_LEN - 1) /
+		 MODES_SOA_ALIGN_LEN * MODES_SOA_ALIGN_LEN;
+	if (stride == 0)
+		stride = MODES_SOA_ALIGN_LEN;
+
+	size = MODES_SOA_ARRAYS_LEN * stride * sizeof(soa[0]);
+	soa = aligned_alloc(MODES_SOA_ALIGN, size);
+	if (!soa)
+		return false;
+	memset(soa, 0, size);
+
+	for (i = 0; i < derived->modes_len; i++) {
+		m = &derived->modes[i];
+
+		flags = 0;
+		if (m->preferred)
+			flags |= DI_INFO_MODES_SOA_PREFERRED;
+		if (m->interlaced)
+			flags |= DI_INFO_MODES_SOA_INTERLACED;
+		if (m->ycbcr420)
+			flags |= DI_INFO_MODES_SOA_YCBCR420;
+		if (m->ycbcr420_only)
+			flags |= DI_INFO_MODES_SOA_YCBCR420_ONLY;
+
+		soa[MODES_SOA_H_ACTIVE * stride + i] = (uint32_t) m->h_active;
+		soa[MODES_SOA_V_ACTIVE * stride + i] = (uint32_t) m->v_active;
+		soa[MODES_SOA_PIXEL_CLOCK_KHZ * stride + i] =
+			(uint32_t) ((m->pixel_clock_hz + 500) / 1000);
+		soa[MODES_SOA_REFRESH_MHZ * stride + i] = (uint32_t) m->refresh_mhz;
+		soa[MODES_SOA_FLAGS * stride + i] = flags;
+	}
+
+	derived->modes_soa = soa;
+	derived->modes_soa_stride = stride;
+	return true;
+}
+
+static bool
+derive_listed_modes(const struct di_edid *edid, struct di_derived_info *derived)
+{
+	struct mode_list list = {0};
+	const struct di_edid_detailed_timing_def *const *defs;
+	const struct di_edid_misc_features *misc;
+	const struct di_edid_ext *const *exts;
+	const struct di_edid_cta *cta;
+	const struct di_displayid *displayid;
+	size_t i, len;
+
+	/* The first DTD is the preferred timing, see EDID section 3.10.1 */
+	misc = di_edid_get_misc_features(edid);
+	defs = di_edid_get_detailed_timing_defs(edid);
+	for (i = 0; defs[i] != NULL; i++)
+		add_detailed_timing_def(&list, defs[i],
+					DI_INFO_MODE_SOURCE_EDID_DETAILED,
+					i == 0 && misc->has_preferred_timing);
+
+	add_standard_timings(&list, di_edid_get_standard_timings(edid));
+	add_dmt_timings(&list, di_edid_get_established_timings_i_ii_dmts(edid),
+			DI_INFO_MODE_SOURCE_EDID_ESTABLISHED);
+	add_display_descriptors(&list, edid);
+
+	exts = di_edid_get_extensions(edid);
+	for (; *exts != NULL; exts++) {
+		cta = di_edid_ext_get_cta(*exts);
+		if (cta)
+			add_cta(&list, edid, cta);
+		displayid = di_edid_ext_get_displayid(*exts);
+		if (displayid)
+			add_displayid(&list, displayid);
+	}
+
+	if (list.failed) {
+		free(list.modes);
+		return false;
+	}
+
+	if (list.len == 0)
+		return build_mode_index(derived) && build_modes_soa(derived);
+
+	qsort(list.modes, list.len, sizeof(list.modes[0]), mode_timing_compare);
+	len = 1;
+	for (i = 1; i < list.len; i++) {
+		if (compare_mode_timings(&list.modes[len - 1], &list.modes[i]) == 0)
+			merge_mode(&list.modes[len - 1], &list.modes[i]);
+		else
+			list.modes[len++] = list.modes[i];
+	}
+	qsort(list.modes, len, sizeof(list.modes[0]), mode_compare);
+
+	derived->modes = list.modes;
+	derived->modes_len = len;
+	return build_mode_index(derived) && build_modes_soa(derived);
+}
+
+/**
+ * Resolutions and refresh rates of the modes implied by range limits. The
+ * CVT aspect ratio is zero for resolutions which don't have a CVT one.
+ */
+static const struct {
+	int32_t h_active, v_active;
+	enum di_edid_cvt_aspect_ratio cvt_aspect_ratio;
+} implied_mode_sizes[] = {
+	{ 640, 480, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 800, 600, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 1024, 768, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 1152, 864, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 1280, 720, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+	{ 1280, 768, DI_EDID_CVT_ASPECT_RATIO_15_9 },
+	{ 1280, 800, DI_EDID_CVT_ASPECT_RATIO_16_10 },
+	{ 1280, 960, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 1280, 1024, DI_EDID_CVT_ASPECT_RATIO_5_4 },
+	{ 1360, 768, 0 },
+	{ 1400, 1050, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 1440, 900, DI_EDID_CVT_ASPECT_RATIO_16_10 },
+	{ 1600, 900, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+	{ 1600, 1200, DI_EDID_CVT_ASPECT_RATIO_4_3 },
+	{ 1680, 1050, DI_EDID_CVT_ASPECT_RATIO_16_10 },
+	{ 1920, 1080, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+	{ 1920, 1200, DI_EDID_CVT_ASPECT_RATIO_16_10 },
+	{ 2048, 1152, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+	{ 2560, 1080, 0 },
+	{ 2560, 1440, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+	{ 2560, 1600, DI_EDID_CVT_ASPECT_RATIO_16_10 },
+	{ 3440, 1440, 0 },
+	{ 3840, 2160, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+	{ 3840, 2400, DI_EDID_CVT_ASPECT_RATIO_16_10 },
+	{ 5120, 2880, DI_EDID_CVT_ASPECT_RATIO_16_9 },
+};
+
+static const int32_t implied_mode_rates_hz[] = {
+	50, 60, 75, 85, 100, 120, 144,
+};
+
+static void
+add_gtf_timing(struct mode_list *list, const struct di_gtf_options *options)
+{
+	struct di_gtf_timing t;
+	struct di_info_mode m = {0};
+
+	di_gtf_compute(&t, options);
+
+	m.h_active = t.h_pixels;
+	m.h_front = t.h_front_porch + t.h_border;
+	m.h_sync = t.h_sync;
+	m.h_back = t.h_back_porch + t.h_border;
+	m.v_active = t.v_lines;
+	m.v_front = t.v_front_porch + t.v_border;
+	m.v_sync = t.v_sync;
+	m.v_back = t.v_back_porch + t.v_border;
+	/* Round to the kHz, like upstream edid-decode */
+	m.pixel_clock_hz = llround(t.pixel_freq_mhz * 1000) * 1000;
+	m.sources = DI_INFO_MODE_SOURCE_EDID_RANGE_LIMITS;
+
+	add_mode(list, &m);
+}
+
+static int64_t
+mode_horiz_freq_hz(const struct di_info_mode *m)
+{
+	return m->pixel_clock_hz / (m->h_active + m->h_front + m->h_sync + m->h_back);
+}
+
+static bool
+mode_fits_range_limits(const struct di_info_mode *m,
+		       const struct di_edid_display_range_limits *range_limits)
+{
+	int64_t horiz_freq_hz;
+
+	if (m->refresh_mhz < range_limits->min_vert_rate_hz * 1000 - 500 ||
+	    m->refresh_mhz > range_limits->max_vert_rate_hz * 1000 + 500)
+		return false;
+
+	/* Horizontal rate limits are rounded to the nearest kHz */
+	horiz_freq_hz = mode_horiz_freq_hz(m);
+	if (horiz_freq_hz < range_limits->min_horiz_rate_hz - 500 ||
+	    horiz_freq_hz > range_limits->max_horiz_rate_hz + 500)
+		return false;
+
+	if (range_limits->max_pixel_clock_hz > 0 &&
+	    m->pixel_clock_hz > range_limits->max_pixel_clock_hz)
+		return false;
+
+	if (range_limits->cvt && range_limits->cvt->max_horiz_px > 0 &&
+	    m->h_active > range_limits->cvt->max_horiz_px)
+		return false;
+
+	return true;
+}
+
+static void
+add_implied_mode(struct mode_list *list,
+		 const struct di_edid_display_range_limits *range_limits,
+		 int32_t h_active, int32_t v_active,
+		 enum di_edid_cvt_aspect_ratio cvt_aspect_ratio, int32_t rate_hz)
+{
+	const struct di_edid_display_range_limits_secondary_gtf *secondary_gtf;
+	const struct di_edid_display_range_limits_cvt *cvt;
+	struct di_gtf_options gtf_options = {0};
+	struct di_cvt_options cvt_options = {0};
+	size_t len;
+
+	len = list->len;
+
+	switch (range_limits->type) {
+	case DI_EDID_DISPLAY_RANGE_LIMITS_DEFAULT_GTF:
+	case DI_EDID_DISPLAY_RANGE_LIMITS_SECONDARY_GTF:
+		gtf_options.h_pixels = h_active;
+		gtf_options.v_lines = v_active;
+		gtf_options.ip_param = DI_GTF_IP_PARAM_V_FRAME_RATE;
+		gtf_options.ip_freq_rqd = rate_hz;
+		gtf_options.m = DI_GTF_DEFAULT_M;
+		gtf_options.c = DI_GTF_DEFAULT_C;
+		gtf_options.k = DI_GTF_DEFAULT_K;
+		gtf_options.j = DI_GTF_DEFAULT_J;
+		add_gtf_timing(list, &gtf_options);
+
+		/* The secondary curve applies from the start horizontal
+		 * frequency onwards */
+		secondary_gtf = range_limits->secondary_gtf;
+		if (secondary_gtf && list->len > len &&
+		    mode_horiz_freq_hz(&list->modes[len]) >= secondary_gtf->start_freq_hz) {
+			list->len = len;
+			gtf_options.m = secondary_gtf->m;
+			gtf_options.c = secondary_gtf->c;
+			gtf_options.k = secondary_gtf->k;
+			gtf_options.j = secondary_gtf->j;
+			add_gtf_timing(list, &gtf_options);
+		}
+		break;
+	case DI_EDID_DISPLAY_RANGE_LIMITS_CVT:
+		cvt = range_limits->cvt;
+		if (!(cvt->supported_aspect_ratio & cvt_aspect_ratio))
+			return;
+		if (cvt->reduced_blanking)
+			cvt_options.red_blank_ver = DI_CVT_REDUCED_BLANKING_V1;
+		else if (cvt->standard_blanking)
+			cvt_options.red_blank_ver = DI_CVT_REDUCED_BLANKING_NONE;
+		else
+			return;
+		cvt_options.h_pixels = h_active;
+		cvt_options.v_lines = v_active;
+		cvt_options.ip_freq_rqd = rate_hz;
+		add_cvt_timing(list, &cvt_options,
+			       DI_INFO_MODE_SOURCE_EDID_RANGE_LIMITS, false);
+		break;
+	default:
+		return;
+	}
+
+	if (list->len > len &&
+	    !mode_fits_range_limits(&list->modes[len], range_limits))
+		list->len = len;
+}
+
+static bool
+derive_implied_modes(const struct di_edid *edid, struct di_derived_info *derived)
+{
+	struct mode_list list = {0};
+	const struct di_edid_misc_features *misc;
+	const struct di_edid_display_descriptor *const *desc;
+	const struct di_edid_display_range_limits *range_limits = NULL;
+	int64_t h_active, v_active, rate_hz;
+	size_t i, j;
+
+	/* default_gtf is only set for EDID 1.3, continuous_freq for 1.4 */
+	misc = di_edid_get_misc_features(edid);
+	if (!misc->continuous_freq && !misc->default_gtf)
+		return true;
+
+	desc = di_edid_get_display_descriptors(edid);
+	for (i = 0; desc[i] != NULL && !range_limits; i++)
+		range_limits = di_edid_display_descriptor_get_range_limits(desc[i]);
+	if (!range_limits)
+		return true;
+
+	for (i = 0; i < sizeof(implied_mode_sizes) / sizeof(implied_mode_sizes[0]); i++) {
+		h_active = implied_mode_sizes[i].h_active;
+		v_active = implied_mode_sizes[i].v_active;
+		for (j = 0; j < sizeof(implied_mode_rates_hz) / sizeof(implied_mode_rates_hz[0]); j++) {
+			rate_hz = implied_mode_rates_hz[j];
+			if (rate_hz < range_limits->min_vert_rate_hz ||
+			    rate_hz > range_limits->max_vert_rate_hz)
+				continue;
+			/* The active area alone gives lower bounds for the
+			 * horizontal rate and pixel clock, skip the formula if
+			 * these already exceed the limits */
+			if (v_active * rate_hz > range_limits->max_horiz_rate_hz)
+				continue;
+			if (range_limits->max_pixel_clock_hz > 0 &&
+			    h_active * v_active * rate_hz > range_limits->max_pixel_clock_hz)
+				continue;
+			add_implied_mode(&list, range_limits,
+					 implied_mode_sizes[i].h_active,
+					 implied_mode_sizes[i].v_active,
+					 implied_mode_sizes[i].cvt_aspect_ratio,
+					 implied_mode_rates_hz[j]);
+		}
+	}
+
+	if (list.failed) {
+		free(list.modes);
+		return false;
+	}
+
+	if (list.len > 0)
+		qsort(list.modes, list.len, sizeof(list.modes[0]), mode_compare);
+
+	derived->implied_modes = list.modes;
+	derived->implied_modes_len = list.len;
+	return true;
+}
+
+bool
+_di_info_derive_modes(const struct di_edid *edid, struct di_derived_info *derived)
+{
+	return derive_listed_modes(edid, derived) &&
+	       derive_implied_modes(edid, derived);
+}
+
+const struct di_info_mode *
+di_info_get_modes(const struct di_info *info, size_t *len)
+{
+	*len = info->derived.modes_len;
+	return info->derived.modes;
+}
+
+bool
+di_info_supports_mode(const struct di_info *info, int32_t h_active,
+		      int32_t v_active, int32_t refresh_mhz, uint32_t flags)
+{
+	const struct di_derived_info *derived = &info->derived;
+	const struct di_info_mode_bucket *b;
+	const struct di_info_mode *m;
+	bool interlaced;
+	size_t i;
+
+	interlaced = flags & DI_INFO_MODE_QUERY_INTERLACED;
+	b = find_mode_bucket(derived->mode_buckets, derived->mode_buckets_len,
+			     h_active, v_active, interlaced);
+	for (i = b->first; i < b->first + b->len; i++) {
+		m = &derived->modes[derived->mode_order[i]];
+		if ((flags & DI_INFO_MODE_QUERY_NO_YCBCR420_ONLY) && m->ycbcr420_only)
+			continue;
+		if (refresh_mhz == 0 || labs((long) m->refresh_mhz - refresh_mhz) <= 500)
+			return true;
+	}
+
+	return false;
+}
+
+size_t
+di_info_supports_modes(const struct di_info *info,
+		       const struct di_info_mode_query *queries, size_t len,
+		       bool *supported)
+{
+	size_t i, count = 0;
+
+	for (i = 0; i < len; i++) {
+		supported[i] = di_info_supports_mode(info, queries[i].h_active,
+						     queries[i].v_active,
+						     queries[i].refresh_mhz,
+						     queries[i].flags);
+		if (supported[i])
+			count++;
+	}
+
+	return count;
+}
+
+static int64_t
+get_max_pixel_clock_hz(const struct di_edid *edid)
+{
+	const struct di_edid_display_descriptor *const *desc;
+	const struct di_edid_display_range_limits *range_limits;
+	size_t i;
+
+	desc = di_edid_get_display_descriptors(edid);
+	for (i = 0; desc[i] != NULL; i++) {
+		range_limits = di_edid_display_descriptor_get_range_limits(desc[i]);
+		if (range_limits)
+			return range_limits->max_pixel_clock_hz;
+	}
+
+	return 0;
+}
+
+/**
+ * Check whether a mode fits a link with the specified color format.
+ *
+ * max_pixel_clock_hz is the maximum pixel clock of the display range limits,
+ * zero if unset. On HDMI it limits the 8 bpc TMDS character rate, so that
+ * YCbCr 4:2:0 modes above the limit may still be supported. On DisplayPort it
+ * limits the pixel clock.
+ */
+static bool
+mode_fits_link(const struct di_info_mode *m,
+	       const struct di_info_link_caps *link_caps,
+	       int64_t max_pixel_clock_hz)
+{
+	int64_t bpc, tmds_clock_hz, bits_per_pixel_x2, capacity;
+	/* TMDS character rate at 8 bpc */
+	int64_t base_tmds_clock_hz;
+
+	bpc = link_caps->bpc > 0 ? link_caps->bpc : 8;
+
+	switch (link_caps->color_format) {
+	case DI_INFO_LINK_COLOR_FORMAT_RGB444:
+		if (m->ycbcr420_only)
+			return false;
+		base_tmds_clock_hz = m->pixel_clock_hz;
+		/* Deep color increases the TMDS character rate */
+		tmds_clock_hz = m->pixel_clock_hz * bpc / 8;
+		bits_per_pixel_x2 = 6 * bpc;
+		break;
+	case DI_INFO_LINK_COLOR_FORMAT_YCBCR422:
+		if (m->ycbcr420_only)
+			return false;
+		base_tmds_clock_hz = m->pixel_clock_hz;
+		/* HDMI carries YCbCr 4:2:2 up to 12 bpc at the 8 bpc rate */
+		tmds_clock_hz = m->pixel_clock_hz;
+		bits_per_pixel_x2 = 4 * bpc;
+		break;
+	case DI_INFO_LINK_COLOR_FORMAT_YCBCR420:
+		if (!m->ycbcr420)
+			return false;
+		base_tmds_clock_hz = m->pixel_clock_hz / 2;
+		tmds_clock_hz = m->pixel_clock_hz * bpc / 16;
+		bits_per_pixel_x2 = 3 * bpc;
+		break;
+	default:
+		return false;
+	}
+
+	if (link_caps->max_tmds_clock_hz > 0 &&
+	    tmds_clock_hz > link_caps->max_tmds_clock_hz)
+		return false;
+
+	/* Deep color is limited by the link, not by the range limits */
+	if (max_pixel_clock_hz > 0 &&
+	    (link_caps->dp_lane_count > 0 ? m->pixel_clock_hz :
+					    base_tmds_clock_hz) > max_pixel_clock_hz)
+		return false;
+
+	if (link_caps->dp_lane_count > 0) {
+		/* Payload rate in bit/s after channel coding */
+		capacity = (int64_t) link_caps->dp_lane_count *
+			   link_caps->dp_link_rate_mbps * 1000 * 1000;
+		if (link_caps->dp_link_rate_mbps >= 10000)
+			capacity = capacity * 128 / 132;
+		else
+			capacity = capacity * 8 / 10;
+		if (m->pixel_clock_hz * bits_per_pixel_x2 / 2 > capacity)
+			return false;
+	}
+
+	return true;
+}
+
+size_t
+di_info_filter_modes(const struct di_info *info,
+		     const struct di_info_link_caps *link_caps,
+		     const struct di_info_mode **out)
+{
+	const struct di_info_mode *m;
+	int64_t max_pixel_clock_hz;
+	size_t i, len = 0;
+
+	max_pixel_clock_hz = get_max_pixel_clock_hz(info->edid);
+
+	for (i = 0; i < info->derived.modes_len; i++) {
+		m = &info->derived.modes[i];
+		if (!mode_fits_link(m, link_caps, max_pixel_clock_hz))
+			continue;
+		out[len++] = m;
+	}
+
+	return len;
+}
+
+const struct di_info_mode *
+di_info_get_implied_modes(const struct di_info *info, size_t *len)
+{
+	*len = info->derived.implied_modes_len;
+	return info->derived.implied_modes;
+}
+
+struct mode_candidate {
+	const struct di_info_mode *mode;
+	bool native;
+	bool ycbcr420;
+};
+
+static bool
+mode_candidate_is_better(const struct mode_candidate *a,
+			 const struct mode_candidate *b)
+{
+	int64_t a_area, b_area;
+
+	if (a->native != b->native)
+		return a->native;
+
+	a_area = (int64_t) a->mode->h_active * a->mode->v_active;
+	b_area = (int64_t) b->mode->h_active * b->mode->v_active;
+	if (a_area != b_area)
+		return a_area > b_area;
+
+	if (a->mode->refresh_mhz != b->mode->refresh_mhz)
+		return a->mode->refresh_mhz > b->mode->refresh_mhz;
+	if (a->mode->interlaced != b->mode->interlaced)
+		return !a->mode->interlaced;
+	if (a->ycbcr420 != b->ycbcr420)
+		return !a->ycbcr420;
+	if (a->mode->preferred != b->mode->preferred)
+		return a->mode->preferred;
+	return a->mode->pixel_clock_hz < b->mode->pixel_clock_hz;
+}
+
+const struct di_info_mode *
+di_info_select_mode(const struct di_info *info,
+		    const struct di_info_mode_policy *policy,
+		    enum di_info_link_color_format *color_format)
+{
+	const struct di_derived_info *derived = &info->derived;
+	const struct di_info_mode *m, *native = NULL;
+	struct di_info_link_caps link_caps = {0};
+	struct mode_candidate best = {0}, cand;
+	int64_t max_pixel_clock_hz;
+	size_t i;
+
+	if (policy->link_caps)
+		link_caps = *policy->link_caps;
+
+	if (policy->flags & DI_INFO_MODE_POLICY_HDR) {
+		if (!derived->hdr_static_metadata.pq &&
+		    !derived->hdr_static_metadata.hlg)
+			return NULL;
+		if (link_caps.bpc < 10)
+			link_caps.bpc = 10;
+	}
+
+	/* Preferred modes are sorted first */
+	if ((policy->flags & DI_INFO_MODE_POLICY_PREFER_NATIVE) &&
+	    derived->modes_len > 0 && derived->modes[0].preferred)
+		native = &derived->modes[0];
+
+	max_pixel_clock_hz = get_max_pixel_clock_hz(info->edid);
+
+	for (i = 0; i < derived->modes_len; i++) {
+		m = &derived->modes[i];
+
+		if (m->interlaced &&
+		    !(policy->flags & DI_INFO_MODE_POLICY_ALLOW_INTERLACED))
+			continue;
+		if (policy->max_pixel_clock_hz > 0 &&
+		    m->pixel_clock_hz > policy->max_pixel_clock_hz)
+			continue;
+		if (policy->max_refresh_mhz > 0 &&
+		    m->refresh_mhz > policy->max_refresh_mhz)
+			continue;
+
+		cand.mode = m;
+		cand.native = native && m->h_active == native->h_active &&
+			      m->v_active == native->v_active;
+		cand.ycbcr420 = false;
+		link_caps.color_format = DI_INFO_LINK_COLOR_FORMAT_RGB444;
+		if (!mode_fits_link(m, &link_caps, max_pixel_clock_hz)) {
+			if (!(policy->flags & DI_INFO_MODE_POLICY_ALLOW_YCBCR420))
+				continue;
+			link_caps.color_format = DI_INFO_LINK_COLOR_FORMAT_YCBCR420;
+			if (!mode_fits_link(m, &link_caps, max_pixel_clock_hz))
+				continue;
+			cand.ycbcr420 = true;
+		}
+
+		if (!best.mode || mode_candidate_is_better(&cand, &best))
+			best = cand;
+	}
+
+	if (best.mode && color_format)
+		*color_format = best.ycbcr420 ? DI_INFO_LINK_COLOR_FORMAT_YCBCR420
+					      : DI_INFO_LINK_COLOR_FORMAT_RGB444;
+	return best.mode;
+}
+
+void
+di_info_get_modes_soa(const struct di_info *info, struct di_info_modes_soa *soa)
+{
+	const uint32_t *arrays = info->derived.modes_soa;
+	size_t stride = info->derived.modes_soa_stride;
+
+	soa->len = info->derived.modes_len;
+	soa->h_active = &arrays[MODES_SOA_H_ACTIVE * stride];
+	soa->v_active = &arrays[MODES_SOA_V_ACTIVE * stride];
+	soa->pixel_clock_khz = &arrays[MODES_SOA_PIXEL_CLOCK_KHZ * stride];
+	soa->refresh_mhz = &arrays[MODES_SOA_REFRESH_MHZ * stride];
+	soa->flags = &arrays[MODES_SOA_FLAGS * stride];
+}
+
+static bool
+mode_to_drm_mode(const struct di_info_mode *m, struct di_info_drm_mode *drm)
+{
+	int64_t h_sync_start, h_sync_end, h_total;
+	int64_t v_sync_start, v_sync_end, v_total;
+
+	/* Vertical porches are given per field, DRM counts lines per frame */
+	h_sync_start = (int64_t) m->h_active + m->h_front;
+	h_sync_end = h_sync_start + m->h_sync;
+	h_total = h_sync_end + m->h_back;
+	if (m->interlaced) {
+		v_sync_start = (int64_t) m->v_active + 2 * (int64_t) m->v_front;
+		v_sync_end = v_sync_start + 2 * (int64_t) m->v_sync;
+		v_total = v_sync_end + 2 * (int64_t) m->v_back + 1;
+	} else {
+		v_sync_start = (int64_t) m->v_active + m->v_front;
+		v_sync_end = v_sync_start + m->v_sync;
+		v_total = v_sync_end + m->v_back;
+	}
+
+	if (h_total > UINT16_MAX || v_total > UINT16_MAX ||
+	    (m->pixel_clock_hz + 500) / 1000 > UINT32_MAX)
+		return false;
+
+	memset(drm, 0, sizeof(*drm));
+	drm->clock = (uint32_t) ((m->pixel_clock_hz + 500) / 1000);
+	drm->hdisplay = (uint16_t) m->h_active;
+	drm->hsync_start = (uint16_t) h_sync_start;
+	drm->hsync_end = (uint16_t) h_sync_end;
+	drm->htotal = (uint16_t) h_total;
+	drm->vdisplay = (uint16_t) m->v_active;
+	drm->vsync_start = (uint16_t) v_sync_start;
+	drm->vsync_end = (uint16_t) v_sync_end;
+	drm->vtotal = (uint16_t) v_total;
+	drm->vrefresh = (uint32_t) ((m->refresh_mhz + 500) / 1000);
+
+	if (m->h_sync_polarity == DI_INFO_MODE_SYNC_POSITIVE)
+		drm->flags |= DI_INFO_DRM_MODE_FLAG_PHSYNC;
+	else if (m->h_sync_polarity == DI_INFO_MODE_SYNC_NEGATIVE)
+		drm->flags |= DI_INFO_DRM_MODE_FLAG_NHSYNC;
+	if (m->v_sync_polarity == DI_INFO_MODE_SYNC_POSITIVE)
+		drm->flags |= DI_INFO_DRM_MODE_FLAG_PVSYNC;
+	else if (m->v_sync_polarity == DI_INFO_MODE_SYNC_NEGATIVE)
+		drm->flags |= DI_INFO_DRM_MODE_FLAG_NVSYNC;
+	if (m->interlaced)
+		drm->flags |= DI_INFO_DRM_MODE_FLAG_INTERLACE;
+
+	drm->type = DI_INFO_DRM_MODE_TYPE_DRIVER;
+	if (m->preferred)
+		drm->type |= DI_INFO_DRM_MODE_TYPE_PREFERRED;
+
+	snprintf(drm->name, sizeof(drm->name), "%dx%d%s",
+		 m->h_active, m->v_active, m->interlaced ? "i" : "");
+	return true;
+}
+
+size_t
+di_info_get_drm_modes(const struct di_info *info,
+		      struct di_info_drm_mode *modes, size_t modes_len)
+{
+	size_t i, len = 0;
+
+	for (i = 0; i < info->derived.modes_len && len < modes_len; i++) {
+		if (mode_to_drm_mode(&info->derived.modes[i], &modes[len]))
+			len++;
+	}
+
+	return len;
+}
@@ -0,0 +1,217 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libdisplay-info/displayid.h>
+
+#include "info.h"
+
+/**
+ * The maximum number of horizontal/vertical tiles, see the 6-bit fields of the
+ * DisplayID Tiled Display Topology Data Block.
+ */
+#define MAX_TILES_PER_AXIS 64
+
+static uint32_t
+tiled_display_hash(const struct di_displayid_tiled_topo *tiled_topo)
+{
+	uint32_t hash;
+
+	hash = ((uint32_t) (uint8_t) tiled_topo->vendor_id[0] << 16 |
+		(uint32_t) (uint8_t) tiled_topo->vendor_id[1] << 8 |
+		(uint32_t) (uint8_t) tiled_topo->vendor_id[2]) * 0x9E3779B1u;
+	hash ^= ((uint32_t) tiled_topo->product_code << 1) * 0x85EBCA77u;
+	hash ^= tiled_topo->serial_number * 0xC2B2AE3Du;
+	hash ^= hash >> 15;
+	return hash;
+}
+
+static bool
+is_same_tiled_display(const struct di_info_tiled_display *display,
+		      const struct di_displayid_tiled_topo *tiled_topo)
+{
+	return memcmp(display->vendor_id, tiled_topo->vendor_id,
+		      sizeof(display->vendor_id)) == 0 &&
+	       display->product_code == tiled_topo->product_code &&
+	       display->serial_number == tiled_topo->serial_number;
+}
+
+static bool
+is_complete(const struct di_info_tiled_display *display)
+{
+	uint64_t seen[MAX_TILES_PER_AXIS] = {0};
+	const struct di_info_tile *tile;
+	uint64_t bit;
+	size_t i;
+
+	if (display->tiles_len !=
+	    (size_t) display->total_horiz_tiles * (size_t) display->total_vert_tiles)
+		return false;
+
+	for (i = 0; i < display->tiles_len; i++) {
+		tile = &display->tiles[i];
+		if (tile->horiz_tile_location >= display->total_horiz_tiles ||
+		    tile->vert_tile_location >= display->total_vert_tiles)
+			return false;
+		bit = (uint64_t) 1 << tile->horiz_tile_location;
+		if (seen[tile->vert_tile_location] & bit)
+			return false;
+		seen[tile->vert_tile_location] |= bit;
+	}
+
+	return true;
+}
+
+/**
+ * Find the highest refresh rate of a progressive mode at the tile size which
+ * all tiles support.
+ */
+static int32_t
+get_combined_refresh_mhz(const struct di_info_tiled_display *display)
+{
+	const struct di_info_tile *first = &display->tiles[0];
+	const struct di_info_mode *modes, *m;
+	size_t modes_len, i, j;
+	int32_t refresh_mhz = 0;
+
+	modes = di_info_get_modes(first->info, &modes_len);
+	for (i = 0; i < modes_len; i++) {
+		m = &modes[i];
+		if (m->h_active != first->width || m->v_active != first->height ||
+		    m->interlaced || m->ycbcr420_only ||
+		    m->refresh_mhz <= refresh_mhz)
+			continue;
+
+		for (j = 1; j < display->tiles_len; j++) {
+			if (!di_info_supports_mode(display->tiles[j].info,
+						   first->width, first->height,
+						   m->refresh_mhz,
+						   DI_INFO_MODE_QUERY_NO_YCBCR420_ONLY))
+				break;
+		}
+		if (j == display->tiles_len)
+			refresh_mhz = m->refresh_mhz;
+	}
+
+	return refresh_mhz;
+}
+
+struct di_info_tile_groups *
+di_info_group_tiles(const struct di_info *const *infos, size_t infos_len)
+{
+	struct di_info_tile_groups *groups;
+	const struct di_displayid_tiled_topo *tiled_topo;
+	struct di_info_tiled_display *display;
+	struct di_info_tile *tile;
+	size_t *slots = NULL, *info_displays = NULL, *display_next = NULL;
+	size_t slots_len, displays_len = 0, tiles_len = 0, i, j;
+
+	groups = calloc(1, sizeof(*groups));
+	if (!groups)
+		return NULL;
+
+	/* Hash table of display indices plus one, zero for empty slots */
+	slots_len = 8;
+	while (slots_len < 2 * infos_len)
+		slots_len *= 2;
+
+	slots = calloc(slots_len, sizeof(slots[0]));
+	info_displays = calloc(infos_len + 1, sizeof(info_displays[0]));
+	display_next = calloc(infos_len + 1, sizeof(display_next[0]));
+	groups->displays = calloc(infos_len + 1, sizeof(groups->displays[0]));
+	groups->display_ptrs = calloc(infos_len + 1, sizeof(groups->display_ptrs[0]));
+	groups->tiles = calloc(infos_len + 1, sizeof(groups->tiles[0]));
+	if (!slots || !info_displays || !display_next || !groups->displays ||
+	    !groups->display_ptrs || !groups->tiles) {
+		di_info_tile_groups_destroy(groups);
+		groups = NULL;
+		goto out;
+	}
+
+	/* Assign each display device to a tiled display, and count tiles */
+	for (i = 0; i < infos_len; i++) {
+		tiled_topo = infos[i]->derived.tiled_topo;
+		if (!tiled_topo) {
+			info_displays[i] = SIZE_MAX;
+			continue;
+		}
+
+		/* Linear probing, the table is never more than half full */
+		j = tiled_display_hash(tiled_topo);
+		while (true) {
+			j &= slots_len - 1;
+			if (slots[j] == 0 ||
+			    is_same_tiled_display(&groups->displays[slots[j] - 1],
+						  tiled_topo))
+				break;
+			j++;
+		}
+
+		if (slots[j] == 0) {
+			display = &groups->displays[displays_len++];
+			memcpy(display->vendor_id, tiled_topo->vendor_id,
+			       sizeof(display->vendor_id));
+			display->product_code = tiled_topo->product_code;
+			display->serial_number = tiled_topo->serial_number;
+			display->total_horiz_tiles = tiled_topo->total_horiz_tiles;
+			display->total_vert_tiles = tiled_topo->total_vert_tiles;
+			slots[j] = displays_len;
+		}
+
+		info_displays[i] = slots[j] - 1;
+		groups->displays[slots[j] - 1].tiles_len++;
+	}
+
+	/* Lay out the tiles of each tiled display contiguously */
+	for (i = 0; i < displays_len; i++) {
+		display_next[i] = tiles_len;
+		tiles_len += groups->displays[i].tiles_len;
+	}
+
+	for (i = 0; i < infos_len; i++) {
+		if (info_displays[i] == SIZE_MAX)
+			continue;
+
+		tiled_topo = infos[i]->derived.tiled_topo;
+		tile = &groups->tiles[display_next[info_displays[i]]++];
+		tile->info = infos[i];
+		/* The low-level tile locations start from one */
+		tile->horiz_tile_location = tiled_topo->horiz_tile_location - 1;
+		tile->vert_tile_location = tiled_topo->vert_tile_location - 1;
+		tile->width = tiled_topo->horiz_tile_pixels;
+		tile->height = tiled_topo->vert_tile_lines;
+		tile->x = tile->horiz_tile_location * tile->width;
+		tile->y = tile->vert_tile_location * tile->height;
+	}
+
+	for (i = 0; i < displays_len; i++) {
+		display = &groups->displays[i];
+		display->tiles = &groups->tiles[display_next[i] - display->tiles_len];
+		display->complete = is_complete(display);
+		display->width = display->total_horiz_tiles * display->tiles[0].width;
+		display->height = display->total_vert_tiles * display->tiles[0].height;
+		display->refresh_mhz = get_combined_refresh_mhz(display);
+		groups->display_ptrs[i] = display;
+	}
+
+out:
+	free(slots);
+	free(info_displays);
+	free(display_next);
+	return groups;
+}
+
+void
+di_info_tile_groups_destroy(struct di_info_tile_groups *groups)
+{
+	free(groups->displays);
+	free(groups->display_ptrs);
+	free(groups->tiles);
+	free(groups);
+}
+
+const struct di_info_tiled_display *const *
+di_info_tile_groups_get_displays(const struct di_info_tile_groups *groups)
+{
+	return groups->display_ptrs;
+}
@@ -7,10 +7,7 @@
 #include "edid.h"
 #include "info.h"
 #include "memory-stream.h"
-
-/* Generated file pnp-id-table.c: */
-const char *
-pnp_id_table(const char *key);
+#include "pnp-id.h"
 
 static bool
 di_cta_data_block_allowed_multiple(enum di_cta_data_block_tag tag)
@@ -39,29 +36,13 @@ static const struct di_cta_data_block *
 di_edid_get_cta_data_block(const struct di_edid *edid,
 			   enum di_cta_data_block_tag tag)
 {
-	const struct di_edid_ext *const *ext;
-
 	/*
 	 * Here we do not handle blocks that are allowed to occur in
 	 * multiple instances.
 	 */
 	assert(!di_cta_data_block_allowed_multiple(tag));
 
-	for (ext = di_edid_get_extensions(edid); *ext; ext++) {
-		const struct di_edid_cta *cta;
-		const struct di_cta_data_block *const *block;
-
-		if (di_edid_ext_get_tag(*ext) != DI_EDID_EXT_CEA)
-			continue;
-
-		cta = di_edid_ext_get_cta(*ext);
-		for (block = di_edid_cta_get_data_blocks(cta); *block; block++) {
-			if (di_cta_data_block_get_tag(*block) == tag)
-				return *block;
-		}
-	}
-
-	return NULL;
+	return di_edid_find_cta_data_block(edid, tag);
 }
 
 static void
@@ -169,64 +150,41 @@ derive_edid_supported_signal_colorimetry(const struct di_edid *edid,
 	ssc->ictcp = cm->ictcp;
 }
 
-struct di_info *
-di_info_parse_edid(const void *data, size_t size)
+static void
+derive_edid_vrr_range(const struct di_edid *edid, struct di_info_vrr_range *vrr)
 {
-	struct memory_stream failure_msg;
-	struct di_edid *edid;
-	struct di_info *info;
-	char *failure_msg_str = NULL;
-
-	if (!memory_stream_open(&failure_msg))
-		return NULL;
-
-	edid = _di_edid_parse(data, size, failure_msg.fp);
-	if (!edid)
-		goto err_failure_msg_file;
-
-	info = calloc(1, sizeof(*info));
-	if (!info)
-		goto err_edid;
-
-	info->edid = edid;
-
-	failure_msg_str = memory_stream_close(&failure_msg);
-	if (failure_msg_str && failure_msg_str[0] != '\0')
-		info->failure_msg = failure_msg_str;
-	else
-		free(failure_msg_str);
-
-	derive_edid_hdr_static_metadata(info->edid, &info->derived.hdr_static_metadata);
-	derive_edid_color_primaries(info->edid, &info->derived.color_primaries);
-	derive_edid_supported_signal_colorimetry(info->edid, &info->derived.supported_signal_colorimetry);
-
-	return info;
-
-err_edid:
-	_di_edid_destroy(edid);
-err_failure_msg_file:
-	memory_stream_cleanup(&failure_msg);
-	return NULL;
-}
+	const struct di_edid_misc_features *misc;
+	const struct di_edid_display_descriptor *const *desc;
+	const struct di_edid_display_range_limits *range_limits = NULL;
+	const struct di_edid_ext *e;
+	size_t i;
 
-void
-di_info_destroy(struct di_info *info)
-{
-	_di_edid_destroy(info->edid);
-	free(info->failure_msg);
-	free(info);
-}
+	desc = di_edid_get_display_descriptors(edid);
+	for (i = 0; desc[i] && !range_limits; i++)
+		range_limits = di_edid_display_descriptor_get_range_limits(desc[i]);
 
-const struct di_edid *
-di_info_get_edid(const struct di_info *info)
-{
-	return info->edid;
-}
+	/* Only EDID 1.4 displays with continuous frequency support may switch
+	 * refresh rates seamlessly within the range limits. This is a weak
+	 * hint: plenty of fixed refresh rate displays set these too. */
+	misc = di_edid_get_misc_features(edid);
+	if (misc->continuous_freq && range_limits &&
+	    range_limits->max_vert_rate_hz > range_limits->min_vert_rate_hz) {
+		vrr->min_hz = range_limits->min_vert_rate_hz;
+		vrr->max_hz = range_limits->max_vert_rate_hz;
+		vrr->sources |= DI_INFO_VRR_SOURCE_EDID_RANGE_LIMITS;
+	}
 
-const char *
-di_info_get_failure_msg(const struct di_info *info)
-{
-	return info->failure_msg;
+	for (i = 0; (e = edid->exts[i]); i++) {
+		if (e->tag != DI_EDID_EXT_CEA || e->cta.hdmi_vrr_min_hz == 0)
+			continue;
+		vrr->min_hz = e->cta.hdmi_vrr_min_hz;
+		if (e->cta.hdmi_vrr_max_hz != 0)
+			vrr->max_hz = e->cta.hdmi_vrr_max_hz;
+		else if (range_limits)
+			vrr->max_hz = range_limits->max_vert_rate_hz;
+		vrr->sources |= DI_INFO_VRR_SOURCE_HDMI;
+		break;
+	}
 }
 
 static void
@@ -255,24 +213,21 @@ encode_ascii_string(FILE *out, const char *str)
 		encode_ascii_byte(out, str[i]);
 }
 
-char *
-di_info_get_make(const struct di_info *info)
+static char *
+derive_edid_make(const struct di_edid *edid)
 {
 	const struct di_edid_vendor_product *evp;
 	char pnp_id[(sizeof(evp->manufacturer)) + 1] = { 0, };
 	const char *manuf;
 	struct memory_stream m;
 
-	if (!info->edid)
-		return NULL;
-
 	if (!memory_stream_open(&m))
 		return NULL;
 
-	evp = di_edid_get_vendor_product(info->edid);
+	evp = di_edid_get_vendor_product(edid);
 	memcpy(pnp_id, evp->manufacturer, sizeof(evp->manufacturer));
 
-	manuf = pnp_id_table(pnp_id);
+	manuf = _di_pnp_id_lookup(pnp_id);
 	if (manuf) {
 		encode_ascii_string(m.fp, manuf);
 		return memory_stream_close(&m);
@@ -285,8 +240,8 @@ di_info_get_make(const struct di_info *info)
 	return memory_stream_close(&m);
 }
 
-char *
-di_info_get_model(const struct di_info *info)
+static char *
+derive_edid_model(const struct di_edid *edid)
 {
 	const struct di_edid_vendor_product *evp;
 	const struct di_edid_display_descriptor *const *desc;
@@ -295,13 +250,10 @@ di_info_get_model(const struct di_info *info)
 	enum di_edid_display_descriptor_tag tag;
 	const char *str;
 
-	if (!info->edid)
-		return NULL;
-
 	if (!memory_stream_open(&m))
 		return NULL;
 
-	desc = di_edid_get_display_descriptors(info->edid);
+	desc = di_edid_get_display_descriptors(edid);
 	for (i = 0; desc[i]; i++) {
 		tag = di_edid_display_descriptor_get_tag(desc[i]);
 		if (tag != DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_NAME)
@@ -313,14 +265,14 @@ di_info_get_model(const struct di_info *info)
 		return memory_stream_close(&m);
 	}
 
-	evp = di_edid_get_vendor_product(info->edid);
+	evp = di_edid_get_vendor_product(edid);
 	fprintf(m.fp, "0x%04" PRIX16, evp->product);
 
 	return memory_stream_close(&m);
 }
 
-char *
-di_info_get_serial(const struct di_info *info)
+static bool
+derive_edid_serial(const struct di_edid *edid, char **serial)
 {
 	const struct di_edid_display_descriptor *const *desc;
 	const struct di_edid_vendor_product *evp;
@@ -329,13 +281,12 @@ di_info_get_serial(const struct di_info *info)
 	enum di_edid_display_descriptor_tag tag;
 	const char *str;
 
-	if (!info->edid)
-		return NULL;
+	*serial = NULL;
 
 	if (!memory_stream_open(&m))
-		return NULL;
+		return false;
 
-	desc = di_edid_get_display_descriptors(info->edid);
+	desc = di_edid_get_display_descriptors(edid);
 	for (i = 0; desc[i]; i++) {
 		tag = di_edid_display_descriptor_get_tag(desc[i]);
 		if (tag != DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_SERIAL)
@@ -344,35 +295,19 @@ di_info_get_serial(const struct di_info *info)
 		if (str[0] == '\0')
 			continue;
 		encode_ascii_string(m.fp, str);
-		return memory_stream_close(&m);
+		*serial = memory_stream_close(&m);
+		return *serial != NULL;
 	}
 
-	evp = di_edid_get_vendor_product(info->edid);
+	evp = di_edid_get_vendor_product(edid);
 	if (evp->serial != 0) {
 		fprintf(m.fp, "0x%08" PRIX32, evp->serial);
-		return memory_stream_close(&m);
+		*serial = memory_stream_close(&m);
+		return *serial != NULL;
 	}
 
 	memory_stream_cleanup(&m);
-	return NULL;
-}
-
-const struct di_hdr_static_metadata *
-di_info_get_hdr_static_metadata(const struct di_info *info)
-{
-	return &info->derived.hdr_static_metadata;
-}
-
-const struct di_color_primaries *
-di_info_get_default_color_primaries(const struct di_info *info)
-{
-	return &info->derived.color_primaries;
-}
-
-const struct di_supported_signal_colorimetry *
-di_info_get_supported_signal_colorimetry(const struct di_info *info)
-{
-	return &info->derived.supported_signal_colorimetry;
+	return true;
 }
 
 static const struct di_displayid *
@@ -406,6 +341,251 @@ displayid_get_display_params(const struct di_displayid *did)
 	return NULL;
 }
 
+static const struct di_displayid_tiled_topo *
+displayid_get_tiled_topo(const struct di_displayid *did)
+{
+	const struct di_displayid_data_block *const *block =
+		di_displayid_get_data_blocks(did);
+
+	for (; *block; block++) {
+		enum di_displayid_data_block_tag tag = di_displayid_data_block_get_tag(*block);
+
+		if (tag == DI_DISPLAYID_DATA_BLOCK_TILED_DISPLAY_TOPO)
+			return di_displayid_data_block_get_tiled_topo(*block);
+	}
+
+	return NULL;
+}
+
+/* 64-bit FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/ */
+#define FINGERPRINT_OFFSET_BASIS UINT64_C(0xcbf29ce484222325)
+#define FINGERPRINT_PRIME UINT64_C(0x100000001b3)
+
+static uint64_t
+fingerprint_update(uint64_t hash, const void *data, size_t size)
+{
+	const uint8_t *bytes = data;
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= FINGERPRINT_PRIME;
+	}
+
+	return hash;
+}
+
+static uint64_t
+fingerprint_update_u32(uint64_t hash, uint32_t val)
+{
+	/* Hash in a fixed byte order so that the result is host-independent */
+	uint8_t bytes[] = {
+		(uint8_t)(val & 0xFF),
+		(uint8_t)((val >> 8) & 0xFF),
+		(uint8_t)((val >> 16) & 0xFF),
+		(uint8_t)(val >> 24),
+	};
+
+	return fingerprint_update(hash, bytes, sizeof(bytes));
+}
+
+static void
+derive_edid_tiled_topo(const struct di_edid *edid,
+		       const struct di_displayid_tiled_topo **tiled_topo)
+{
+	const struct di_displayid *did;
+
+	did = edid_get_displayid(edid);
+	if (did)
+		*tiled_topo = displayid_get_tiled_topo(did);
+}
+
+static void
+derive_edid_fingerprint(const struct di_edid *edid,
+			const struct di_displayid_tiled_topo *tiled_topo,
+			uint64_t *fingerprint)
+{
+	const struct di_edid_vendor_product *evp;
+	const struct di_edid_display_descriptor *const *desc;
+	uint64_t hash = FINGERPRINT_OFFSET_BASIS;
+	const char *str;
+	size_t i;
+
+	evp = di_edid_get_vendor_product(edid);
+	hash = fingerprint_update(hash, evp->manufacturer, sizeof(evp->manufacturer));
+	hash = fingerprint_update_u32(hash, evp->product);
+	hash = fingerprint_update_u32(hash, evp->serial);
+
+	/* The terminating NUL byte separates the fields */
+	desc = di_edid_get_display_descriptors(edid);
+	for (i = 0; desc[i]; i++) {
+		if (di_edid_display_descriptor_get_tag(desc[i]) !=
+		    DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_SERIAL)
+			continue;
+		str = di_edid_display_descriptor_get_string(desc[i]);
+		hash = fingerprint_update(hash, str, strlen(str) + 1);
+		break;
+	}
+	if (!desc[i])
+		hash = fingerprint_update(hash, "", 1);
+
+	if (tiled_topo) {
+		hash = fingerprint_update(hash, tiled_topo->vendor_id,
+					  sizeof(tiled_topo->vendor_id));
+		hash = fingerprint_update_u32(hash, tiled_topo->product_code);
+		hash = fingerprint_update_u32(hash, tiled_topo->serial_number);
+	}
+
+	*fingerprint = hash;
+}
+
+struct di_info *
+di_info_parse_edid(const void *data, size_t size)
+{
+	struct memory_stream failure_msg;
+	struct di_edid *edid;
+	struct di_info *info;
+	char *failure_msg_str = NULL;
+
+	if (!memory_stream_open(&failure_msg))
+		return NULL;
+
+	edid = _di_edid_parse(data, size, failure_msg.fp);
+	if (!edid)
+		goto err_failure_msg_file;
+
+	info = calloc(1, sizeof(*info));
+	if (!info)
+		goto err_edid;
+
+	info->edid = edid;
+
+	failure_msg_str = memory_stream_close(&failure_msg);
+	if (failure_msg_str && failure_msg_str[0] != '\0')
+		info->failure_msg = failure_msg_str;
+	else
+		free(failure_msg_str);
+
+	derive_edid_hdr_static_metadata(info->edid, &info->derived.hdr_static_metadata);
+	derive_edid_color_primaries(info->edid, &info->derived.color_primaries);
+	derive_edid_supported_signal_colorimetry(info->edid, &info->derived.supported_signal_colorimetry);
+	derive_edid_tiled_topo(info->edid, &info->derived.tiled_topo);
+	derive_edid_fingerprint(info->edid, info->derived.tiled_topo,
+				&info->derived.fingerprint);
+	derive_edid_vrr_range(info->edid, &info->derived.vrr_range);
+
+	info->derived.make = derive_edid_make(info->edid);
+	info->derived.model = derive_edid_model(info->edid);
+	if (!info->derived.make || !info->derived.model ||
+	    !derive_edid_serial(info->edid, &info->derived.serial) ||
+	    !_di_info_derive_modes(info->edid, &info->derived)) {
+		di_info_destroy(info);
+		return NULL;
+	}
+
+	return info;
+
+err_edid:
+	_di_edid_destroy(edid);
+err_failure_msg_file:
+	memory_stream_cleanup(&failure_msg);
+	return NULL;
+}
+
+void
+di_info_destroy(struct di_info *info)
+{
+	_di_edid_destroy(info->edid);
+	free(info->failure_msg);
+	free(info->derived.make);
+	free(info->derived.model);
+	free(info->derived.serial);
+	free(info->derived.modes);
+	free(info->derived.mode_buckets);
+	free(info->derived.mode_order);
+	free(info->derived.modes_soa);
+	free(info->derived.implied_modes);
+	free(info);
+}
+
+const struct di_edid *
+di_info_get_edid(const struct di_info *info)
+{
+	return info->edid;
+}
+
+const char *
+di_info_get_failure_msg(const struct di_info *info)
+{
+	return info->failure_msg;
+}
+
+const char *
+di_info_peek_make(const struct di_info *info)
+{
+	return info->derived.make;
+}
+
+char *
+di_info_get_make(const struct di_info *info)
+{
+	const char *make = di_info_peek_make(info);
+
+	return make ? strdup(make) : NULL;
+}
+
+const char *
+di_info_peek_model(const struct di_info *info)
+{
+	return info->derived.model;
+}
+
+char *
+di_info_get_model(const struct di_info *info)
+{
+	const char *model = di_info_peek_model(info);
+
+	return model ? strdup(model) : NULL;
+}
+
+const char *
+di_info_peek_serial(const struct di_info *info)
+{
+	return info->derived.serial;
+}
+
+char *
+di_info_get_serial(const struct di_info *info)
+{
+	const char *serial = di_info_peek_serial(info);
+
+	return serial ? strdup(serial) : NULL;
+}
+
+const struct di_hdr_static_metadata *
+di_info_get_hdr_static_metadata(const struct di_info *info)
+{
+	return &info->derived.hdr_static_metadata;
+}
+
+const struct di_color_primaries *
+di_info_get_default_color_primaries(const struct di_info *info)
+{
+	return &info->derived.color_primaries;
+}
+
+const struct di_supported_signal_colorimetry *
+di_info_get_supported_signal_colorimetry(const struct di_info *info)
+{
+	return &info->derived.supported_signal_colorimetry;
+}
+
+const struct di_info_vrr_range *
+di_info_get_vrr_range(const struct di_info *info)
+{
+	return &info->derived.vrr_range;
+}
+
 float
 di_info_get_default_gamma(const struct di_info *info)
 {
@@ -433,3 +613,467 @@ di_info_get_default_gamma(const struct di_info *info)
 
 	return di_edid_get_basic_gamma(edid);
 }
+
+uint64_t
+di_info_get_fingerprint(const struct di_info *info)
+{
+	return info->derived.fingerprint;
+}
+
+static void
+copy_summary_str(char *dst, size_t dst_size, const char *src)
+{
+	snprintf(dst, dst_size, "%s", src ? src : "");
+}
+
+void
+di_info_get_summary(const struct di_info *info, struct di_info_summary *summary)
+{
+	const struct di_edid *edid = info->edid;
+	const struct di_edid_screen_size *screen_size;
+	const struct di_edid_misc_features *misc;
+	const struct di_edid_detailed_timing_def *const *dtds;
+	const struct di_edid_detailed_timing_def *dtd;
+	const struct di_edid_display_descriptor *const *desc;
+	const struct di_edid_display_range_limits *range_limits;
+	const struct di_edid_ext *const *ext;
+	struct di_info_mode mode;
+	size_t i;
+
+	memset(summary, 0, sizeof(*summary));
+
+	copy_summary_str(summary->make, sizeof(summary->make), di_info_peek_make(info));
+	copy_summary_str(summary->model, sizeof(summary->model), di_info_peek_model(info));
+	copy_summary_str(summary->serial, sizeof(summary->serial), di_info_peek_serial(info));
+	summary->fingerprint = info->derived.fingerprint;
+
+	summary->default_gamma = di_info_get_default_gamma(info);
+	summary->hdr_static_metadata = info->derived.hdr_static_metadata;
+	summary->default_color_primaries = info->derived.color_primaries;
+	summary->supported_signal_colorimetry = info->derived.supported_signal_colorimetry;
+
+	screen_size = di_edid_get_screen_size(edid);
+	summary->screen_width_cm = screen_size->width_cm;
+	summary->screen_height_cm = screen_size->height_cm;
+
+	/* The first DTD is the preferred timing, see EDID section 3.10.1 */
+	misc = di_edid_get_misc_features(edid);
+	dtds = di_edid_get_detailed_timing_defs(edid);
+	dtd = dtds[0];
+	if (misc->has_preferred_timing && dtd) {
+		/* Same timing as the corresponding di_info_get_modes() entry */
+		_di_info_mode_from_detailed_timing_def(&mode, dtd);
+
+		summary->has_preferred_timing = true;
+		summary->preferred_horiz_video = dtd->horiz_video;
+		summary->preferred_vert_video = dtd->vert_video;
+		summary->preferred_pixel_clock_hz = dtd->pixel_clock_hz;
+		summary->preferred_interlaced = dtd->interlaced;
+		summary->preferred_refresh_rate_hz = mode.refresh_mhz / 1000.0;
+	}
+
+	desc = di_edid_get_display_descriptors(edid);
+	for (i = 0; desc[i]; i++) {
+		range_limits = di_edid_display_descriptor_get_range_limits(desc[i]);
+		if (!range_limits)
+			continue;
+		summary->has_range_limits = true;
+		summary->min_vert_rate_hz = range_limits->min_vert_rate_hz;
+		summary->max_vert_rate_hz = range_limits->max_vert_rate_hz;
+		summary->min_horiz_rate_hz = range_limits->min_horiz_rate_hz;
+		summary->max_horiz_rate_hz = range_limits->max_horiz_rate_hz;
+		summary->max_pixel_clock_hz = range_limits->max_pixel_clock_hz;
+		break;
+	}
+
+	for (ext = di_edid_get_extensions(edid); *ext; ext++) {
+		switch (di_edid_ext_get_tag(*ext)) {
+		case DI_EDID_EXT_CEA:
+			summary->has_cta = true;
+			break;
+		case DI_EDID_EXT_DISPLAYID:
+			summary->has_displayid = true;
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static enum di_info_diff_section
+display_descriptor_section(enum di_edid_display_descriptor_tag tag)
+{
+	switch (tag) {
+	case DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_SERIAL:
+	case DI_EDID_DISPLAY_DESCRIPTOR_PRODUCT_NAME:
+		return DI_INFO_DIFF_IDENTITY;
+	case DI_EDID_DISPLAY_DESCRIPTOR_RANGE_LIMITS:
+		return DI_INFO_DIFF_RANGE_LIMITS;
+	case DI_EDID_DISPLAY_DESCRIPTOR_STD_TIMING_IDS:
+		return DI_INFO_DIFF_STANDARD_TIMINGS;
+	case DI_EDID_DISPLAY_DESCRIPTOR_ESTABLISHED_TIMINGS_III:
+		return DI_INFO_DIFF_ESTABLISHED_TIMINGS;
+	default:
+		return DI_INFO_DIFF_OTHER_DESCRIPTORS;
+	}
+}
+
+static size_t
+next_display_descriptor(const struct di_edid *edid, size_t i,
+			enum di_info_diff_section section)
+{
+	while (edid->display_descriptors[i] &&
+	       display_descriptor_section(edid->display_descriptors[i]->tag) != section)
+		i++;
+	return i;
+}
+
+static bool
+display_descriptors_equal(const struct di_edid *a, const struct di_edid *b,
+			  enum di_info_diff_section section)
+{
+	size_t i, j;
+
+	i = next_display_descriptor(a, 0, section);
+	j = next_display_descriptor(b, 0, section);
+	while (a->display_descriptors[i] && b->display_descriptors[j]) {
+		if (!_di_edid_display_descriptor_equal(a->display_descriptors[i],
+						       b->display_descriptors[j]))
+			return false;
+		i = next_display_descriptor(a, i + 1, section);
+		j = next_display_descriptor(b, j + 1, section);
+	}
+
+	return !a->display_descriptors[i] && !b->display_descriptors[j];
+}
+
+static bool
+vendor_product_equal(const struct di_edid_vendor_product *a,
+		     const struct di_edid_vendor_product *b)
+{
+	return memcmp(a->manufacturer, b->manufacturer, sizeof(a->manufacturer)) == 0 &&
+	       a->product == b->product &&
+	       a->serial == b->serial &&
+	       a->manufacture_week == b->manufacture_week &&
+	       a->manufacture_year == b->manufacture_year &&
+	       a->model_year == b->model_year;
+}
+
+static bool
+basic_params_equal(const struct di_edid *a, const struct di_edid *b)
+{
+	const struct di_edid_chromaticity_coords *coords_a = &a->chromaticity_coords;
+	const struct di_edid_chromaticity_coords *coords_b = &b->chromaticity_coords;
+
+	return a->version == b->version &&
+	       a->revision == b->revision &&
+	       a->is_digital == b->is_digital &&
+	       a->video_input_analog.signal_level_std == b->video_input_analog.signal_level_std &&
+	       a->video_input_analog.video_setup == b->video_input_analog.video_setup &&
+	       a->video_input_analog.sync_separate == b->video_input_analog.sync_separate &&
+	       a->video_input_analog.sync_composite == b->video_input_analog.sync_composite &&
+	       a->video_input_analog.sync_on_green == b->video_input_analog.sync_on_green &&
+	       a->video_input_analog.sync_serrations == b->video_input_analog.sync_serrations &&
+	       a->video_input_digital.dfp1 == b->video_input_digital.dfp1 &&
+	       a->video_input_digital.color_bit_depth == b->video_input_digital.color_bit_depth &&
+	       a->video_input_digital.interface == b->video_input_digital.interface &&
+	       a->screen_size.width_cm == b->screen_size.width_cm &&
+	       a->screen_size.height_cm == b->screen_size.height_cm &&
+	       a->screen_size.landscape_aspect_ratio == b->screen_size.landscape_aspect_ratio &&
+	       a->screen_size.portait_aspect_ratio == b->screen_size.portait_aspect_ratio &&
+	       a->gamma == b->gamma &&
+	       a->dpms.standby == b->dpms.standby &&
+	       a->dpms.suspend == b->dpms.suspend &&
+	       a->dpms.off == b->dpms.off &&
+	       a->display_color_type == b->display_color_type &&
+	       a->color_encoding_formats.rgb444 == b->color_encoding_formats.rgb444 &&
+	       a->color_encoding_formats.ycrcb444 == b->color_encoding_formats.ycrcb444 &&
+	       a->color_encoding_formats.ycrcb422 == b->color_encoding_formats.ycrcb422 &&
+	       a->misc_features.has_preferred_timing == b->misc_features.has_preferred_timing &&
+	       a->misc_features.default_gtf == b->misc_features.default_gtf &&
+	       a->misc_features.srgb_is_primary == b->misc_features.srgb_is_primary &&
+	       a->misc_features.preferred_timing_is_native == b->misc_features.preferred_timing_is_native &&
+	       a->misc_features.continuous_freq == b->misc_features.continuous_freq &&
+	       coords_a->red_x == coords_b->red_x &&
+	       coords_a->red_y == coords_b->red_y &&
+	       coords_a->green_x == coords_b->green_x &&
+	       coords_a->green_y == coords_b->green_y &&
+	       coords_a->blue_x == coords_b->blue_x &&
+	       coords_a->blue_y == coords_b->blue_y &&
+	       coords_a->white_x == coords_b->white_x &&
+	       coords_a->white_y == coords_b->white_y;
+}
+
+static bool
+hdr_static_metadata_equal(const struct di_hdr_static_metadata *a,
+			  const struct di_hdr_static_metadata *b)
+{
+	return a->desired_content_max_luminance == b->desired_content_max_luminance &&
+	       a->desired_content_max_frame_avg_luminance == b->desired_content_max_frame_avg_luminance &&
+	       a->desired_content_min_luminance == b->desired_content_min_luminance &&
+	       a->type1 == b->type1 &&
+	       a->traditional_sdr == b->traditional_sdr &&
+	       a->traditional_hdr == b->traditional_hdr &&
+	       a->pq == b->pq &&
+	       a->hlg == b->hlg;
+}
+
+static bool
+detailed_timing_defs_equal(struct di_edid_detailed_timing_def_priv *const *a,
+			   struct di_edid_detailed_timing_def_priv *const *b)
+{
+	size_t i;
+
+	for (i = 0; a[i] && b[i]; i++) {
+		if (!_di_edid_detailed_timing_def_equal(a[i], b[i]))
+			return false;
+	}
+
+	return !a[i] && !b[i];
+}
+
+static const struct di_edid_ext *
+next_ext(const struct di_edid *edid, size_t *i, enum di_edid_ext_tag tag)
+{
+	const struct di_edid_ext *ext;
+
+	while ((ext = edid->exts[*i])) {
+		(*i)++;
+		if (ext->tag == tag)
+			return ext;
+	}
+
+	return NULL;
+}
+
+static bool
+extension_tags_equal(const struct di_edid *a, const struct di_edid *b)
+{
+	size_t i;
+
+	if (a->exts_len != b->exts_len)
+		return false;
+
+	for (i = 0; i < a->exts_len; i++) {
+		if (a->exts[i]->tag != b->exts[i]->tag)
+			return false;
+	}
+
+	return true;
+}
+
+static const struct di_edid_detailed_timing_def_priv *
+next_cta_detailed_timing_def(const struct di_edid *edid, size_t *ext, size_t *def)
+{
+	const struct di_edid_ext *e;
+	const struct di_edid_detailed_timing_def_priv *dtd;
+
+	for (; (e = edid->exts[*ext]); (*ext)++, *def = 0) {
+		if (e->tag != DI_EDID_EXT_CEA)
+			continue;
+		if ((dtd = e->cta.detailed_timing_defs[*def])) {
+			(*def)++;
+			return dtd;
+		}
+	}
+
+	return NULL;
+}
+
+static bool
+cta_detailed_timing_defs_equal(const struct di_edid *a, const struct di_edid *b)
+{
+	size_t ext_a = 0, ext_b = 0, def_a = 0, def_b = 0;
+	const struct di_edid_detailed_timing_def_priv *dtd_a, *dtd_b;
+
+	while (true) {
+		dtd_a = next_cta_detailed_timing_def(a, &ext_a, &def_a);
+		dtd_b = next_cta_detailed_timing_def(b, &ext_b, &def_b);
+		if (!dtd_a || !dtd_b)
+			return !dtd_a && !dtd_b;
+		if (!_di_edid_detailed_timing_def_equal(dtd_a, dtd_b))
+			return false;
+	}
+}
+
+static bool
+cta_headers_equal(const struct di_edid *a, const struct di_edid *b)
+{
+	size_t i = 0, j = 0;
+	const struct di_edid_ext *ext_a, *ext_b;
+
+	while (true) {
+		ext_a = next_ext(a, &i, DI_EDID_EXT_CEA);
+		ext_b = next_ext(b, &j, DI_EDID_EXT_CEA);
+		if (!ext_a || !ext_b)
+			return !ext_a && !ext_b;
+		if (ext_a->cta.revision != ext_b->cta.revision ||
+		    ext_a->cta.flags.it_underscan != ext_b->cta.flags.it_underscan ||
+		    ext_a->cta.flags.basic_audio != ext_b->cta.flags.basic_audio ||
+		    ext_a->cta.flags.ycc444 != ext_b->cta.flags.ycc444 ||
+		    ext_a->cta.flags.ycc422 != ext_b->cta.flags.ycc422 ||
+		    ext_a->cta.flags.native_dtds != ext_b->cta.flags.native_dtds ||
+		    ext_a->cta.hdmi_vrr_min_hz != ext_b->cta.hdmi_vrr_min_hz ||
+		    ext_a->cta.hdmi_vrr_max_hz != ext_b->cta.hdmi_vrr_max_hz)
+			return false;
+	}
+}
+
+static const struct di_cta_data_block *
+next_cta_data_block(const struct di_edid *edid, size_t *ext, size_t *block,
+		    enum di_cta_data_block_tag tag)
+{
+	const struct di_edid_ext *e;
+	const struct di_cta_data_block *data_block;
+
+	for (; (e = edid->exts[*ext]); (*ext)++, *block = 0) {
+		if (e->tag != DI_EDID_EXT_CEA)
+			continue;
+		while ((data_block = e->cta.data_blocks[*block])) {
+			(*block)++;
+			if (data_block->tag == tag)
+				return data_block;
+		}
+	}
+
+	return NULL;
+}
+
+static bool
+cta_data_blocks_equal(const struct di_edid *a, const struct di_edid *b,
+		      enum di_cta_data_block_tag tag)
+{
+	size_t ext_a = 0, ext_b = 0, block_a = 0, block_b = 0;
+	const struct di_cta_data_block *data_block_a, *data_block_b;
+
+	while (true) {
+		data_block_a = next_cta_data_block(a, &ext_a, &block_a, tag);
+		data_block_b = next_cta_data_block(b, &ext_b, &block_b, tag);
+		if (!data_block_a || !data_block_b)
+			return !data_block_a && !data_block_b;
+		if (!_di_cta_data_block_equal(data_block_a, data_block_b))
+			return false;
+	}
+}
+
+static const struct di_displayid_data_block *
+next_displayid_data_block(const struct di_edid *edid, size_t *ext, size_t *block,
+			  enum di_displayid_data_block_tag tag)
+{
+	const struct di_edid_ext *e;
+	const struct di_displayid_data_block *data_block;
+
+	for (; (e = edid->exts[*ext]); (*ext)++, *block = 0) {
+		if (e->tag != DI_EDID_EXT_DISPLAYID)
+			continue;
+		while ((data_block = e->displayid.data_blocks[*block])) {
+			(*block)++;
+			if (data_block->tag == tag)
+				return data_block;
+		}
+	}
+
+	return NULL;
+}
+
+static bool
+displayid_data_blocks_equal(const struct di_edid *a, const struct di_edid *b,
+			    enum di_displayid_data_block_tag tag)
+{
+	size_t ext_a = 0, ext_b = 0, block_a = 0, block_b = 0;
+	const struct di_displayid_data_block *data_block_a, *data_block_b;
+
+	while (true) {
+		data_block_a = next_displayid_data_block(a, &ext_a, &block_a, tag);
+		data_block_b = next_displayid_data_block(b, &ext_b, &block_b, tag);
+		if (!data_block_a || !data_block_b)
+			return !data_block_a && !data_block_b;
+		if (!_di_displayid_data_block_equal(data_block_a, data_block_b))
+			return false;
+	}
+}
+
+static bool
+displayid_headers_equal(const struct di_edid *a, const struct di_edid *b)
+{
+	size_t i = 0, j = 0;
+	const struct di_edid_ext *ext_a, *ext_b;
+
+	while (true) {
+		ext_a = next_ext(a, &i, DI_EDID_EXT_DISPLAYID);
+		ext_b = next_ext(b, &j, DI_EDID_EXT_DISPLAYID);
+		if (!ext_a || !ext_b)
+			return !ext_a && !ext_b;
+		if (ext_a->displayid.version != ext_b->displayid.version ||
+		    ext_a->displayid.revision != ext_b->displayid.revision ||
+		    ext_a->displayid.product_type != ext_b->displayid.product_type)
+			return false;
+	}
+}
+
+void
+di_info_diff(const struct di_info *a, const struct di_info *b,
+	     struct di_info_diff *diff)
+{
+	const struct di_edid *edid_a = a->edid, *edid_b = b->edid;
+	enum di_cta_data_block_tag cta_tag;
+	enum di_displayid_data_block_tag displayid_tag;
+
+	memset(diff, 0, sizeof(*diff));
+
+	if (!vendor_product_equal(&edid_a->vendor_product, &edid_b->vendor_product) ||
+	    !display_descriptors_equal(edid_a, edid_b, DI_INFO_DIFF_IDENTITY))
+		diff->sections |= DI_INFO_DIFF_IDENTITY;
+
+	if (!basic_params_equal(edid_a, edid_b))
+		diff->sections |= DI_INFO_DIFF_BASIC_PARAMS;
+
+	/* Only bool members, so the structure has no padding */
+	if (memcmp(&edid_a->established_timings_i_ii, &edid_b->established_timings_i_ii,
+		   sizeof(edid_a->established_timings_i_ii)) != 0 ||
+	    !display_descriptors_equal(edid_a, edid_b, DI_INFO_DIFF_ESTABLISHED_TIMINGS))
+		diff->sections |= DI_INFO_DIFF_ESTABLISHED_TIMINGS;
+
+	if (!_di_edid_standard_timings_equal(edid_a->standard_timings,
+					     edid_b->standard_timings) ||
+	    !display_descriptors_equal(edid_a, edid_b, DI_INFO_DIFF_STANDARD_TIMINGS))
+		diff->sections |= DI_INFO_DIFF_STANDARD_TIMINGS;
+
+	if (!detailed_timing_defs_equal(edid_a->detailed_timing_defs,
+					edid_b->detailed_timing_defs) ||
+	    !cta_detailed_timing_defs_equal(edid_a, edid_b))
+		diff->sections |= DI_INFO_DIFF_DETAILED_TIMINGS;
+
+	if (!display_descriptors_equal(edid_a, edid_b, DI_INFO_DIFF_RANGE_LIMITS))
+		diff->sections |= DI_INFO_DIFF_RANGE_LIMITS;
+
+	if (!display_descriptors_equal(edid_a, edid_b, DI_INFO_DIFF_OTHER_DESCRIPTORS))
+		diff->sections |= DI_INFO_DIFF_OTHER_DESCRIPTORS;
+
+	if (!extension_tags_equal(edid_a, edid_b))
+		diff->sections |= DI_INFO_DIFF_EXTENSIONS;
+
+	if (!cta_headers_equal(edid_a, edid_b))
+		diff->sections |= DI_INFO_DIFF_CTA;
+	for (cta_tag = DI_CTA_DATA_BLOCK_AUDIO;
+	     cta_tag <= DI_CTA_DATA_BLOCK_HDMI_SINK_CAP; cta_tag++) {
+		if (!cta_data_blocks_equal(edid_a, edid_b, cta_tag))
+			diff->cta_data_block_tags |= UINT32_C(1) << cta_tag;
+	}
+	if (diff->cta_data_block_tags != 0)
+		diff->sections |= DI_INFO_DIFF_CTA;
+
+	if (!displayid_headers_equal(edid_a, edid_b))
+		diff->sections |= DI_INFO_DIFF_DISPLAYID;
+	for (displayid_tag = DI_DISPLAYID_DATA_BLOCK_PRODUCT_ID;
+	     displayid_tag <= DI_DISPLAYID_DATA_BLOCK_TYPE_VI_TIMING; displayid_tag++) {
+		if (!displayid_data_blocks_equal(edid_a, edid_b, displayid_tag))
+			diff->displayid_data_block_tags |= UINT32_C(1) << displayid_tag;
+	}
+	if (diff->displayid_data_block_tags != 0)
+		diff->sections |= DI_INFO_DIFF_DISPLAYID;
+
+	if (!hdr_static_metadata_equal(&a->derived.hdr_static_metadata,
+				       &b->derived.hdr_static_metadata))
+		diff->sections |= DI_INFO_DIFF_HDR_STATIC_METADATA;
+}
@@ -0,0 +1,188 @@
+#include <ctype.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "pnp-id.h"
+
+/* Generated file pnp-id-table.c: */
+const char *
+pnp_id_table(const char *key);
+
+#ifdef DI_RUNTIME_PNP_IDS_PATH
+
+struct runtime_pnp_id {
+	uint32_t key;
+	uint32_t name_offset; /* into runtime_pnp_ids.pool */
+};
+
+/* Loaded once, then read-only until the process exits */
+static struct {
+	struct runtime_pnp_id *entries;
+	size_t entries_len;
+	char *pool;
+} runtime_pnp_ids;
+
+static pthread_once_t runtime_pnp_ids_once = PTHREAD_ONCE_INIT;
+
+static uint32_t
+pnp_id_key(const char *pnp_id, size_t len)
+{
+	size_t i;
+	uint32_t u = 0;
+
+	for (i = 0; i < len; i++)
+		u = (u << 8) | (uint8_t) pnp_id[i];
+
+	return u;
+}
+
+static int
+runtime_pnp_id_compare(const void *a_ptr, const void *b_ptr)
+{
+	const struct runtime_pnp_id *a = a_ptr, *b = b_ptr;
+
+	if (a->key < b->key)
+		return -1;
+	return a->key > b->key;
+}
+
+/**
+ * Parse the lines of a pnp.ids file, in the same way as gen-search-table.py:
+ * a 3-character PNP ID, whitespace and the manufacturer name.
+ */
+static void
+parse_pnp_ids(const char *data, size_t size)
+{
+	const char *line, *end, *id, *id_end, *name, *name_end;
+	size_t lines_len = 1, pool_len = 0, len = 0, i;
+	struct runtime_pnp_id *entries;
+	char *pool;
+
+	if (size >= UINT32_MAX)
+		return;
+
+	for (i = 0; i < size; i++) {
+		if (data[i] == '\n')
+			lines_len++;
+	}
+
+	entries = calloc(lines_len, sizeof(entries[0]));
+	pool = malloc(size + 1);
+	if (!entries || !pool) {
+		free(entries);
+		free(pool);
+		return;
+	}
+
+	for (line = data; line < data + size; line = end + 1) {
+		end = memchr(line, '\n', (size_t) (data + size - line));
+		if (!end)
+			end = data + size;
+
+		id = line;
+		while (id < end && isspace((unsigned char) *id))
+			id++;
+		id_end = id;
+		while (id_end < end && !isspace((unsigned char) *id_end))
+			id_end++;
+		if (id_end - id != 3)
+			continue;
+
+		name = id_end;
+		while (name < end && isspace((unsigned char) *name))
+			name++;
+		name_end = end;
+		while (name_end > name && isspace((unsigned char) name_end[-1]))
+			name_end--;
+		if (name == name_end)
+			continue;
+
+		entries[len].key = pnp_id_key(id, 3);
+		entries[len].name_offset = (uint32_t) pool_len;
+		len++;
+
+		memcpy(&pool[pool_len], name, (size_t) (name_end - name));
+		pool_len += (size_t) (name_end - name);
+		pool[pool_len++] = '\0';
+	}
+
+	qsort(entries, len, sizeof(entries[0]), runtime_pnp_id_compare);
+
+	runtime_pnp_ids.entries = entries;
+	runtime_pnp_ids.entries_len = len;
+	runtime_pnp_ids.pool = pool;
+}
+
+static void
+load_runtime_pnp_ids(void)
+{
+	int fd;
+	struct stat st;
+	void *data;
+
+	fd = open(DI_RUNTIME_PNP_IDS_PATH, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return;
+	}
+
+	data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return;
+
+	parse_pnp_ids(data, (size_t) st.st_size);
+
+	munmap(data, (size_t) st.st_size);
+}
+
+static const char *
+runtime_pnp_id_lookup(const char *pnp_id)
+{
+	struct runtime_pnp_id key;
+	const struct runtime_pnp_id *entry;
+	size_t len;
+
+	len = strlen(pnp_id);
+	if (len != 3)
+		return NULL;
+
+	pthread_once(&runtime_pnp_ids_once, load_runtime_pnp_ids);
+	if (runtime_pnp_ids.entries_len == 0)
+		return NULL;
+
+	key.key = pnp_id_key(pnp_id, len);
+	entry = bsearch(&key, runtime_pnp_ids.entries,
+			runtime_pnp_ids.entries_len,
+			sizeof(runtime_pnp_ids.entries[0]),
+			runtime_pnp_id_compare);
+	if (!entry)
+		return NULL;
+	return &runtime_pnp_ids.pool[entry->name_offset];
+}
+
+#endif
+
+const char *
+_di_pnp_id_lookup(const char *pnp_id)
+{
+	const char *name;
+
+	name = pnp_id_table(pnp_id);
+#ifdef DI_RUNTIME_PNP_IDS_PATH
+	if (!name)
+		name = runtime_pnp_id_lookup(pnp_id);
+#endif
+
+	return name;
+}
@@ -1,9 +1,14 @@
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <assert.h>
 
+#include <libdisplay-info/cta.h>
+#include <libdisplay-info/dmt.h>
+#include <libdisplay-info/edid.h>
 #include <libdisplay-info/info.h>
 
 static const char *
@@ -18,6 +23,14 @@ yes_no(bool cond)
 	return cond ? "yes" : "no";
 }
 
+static bool
+str_eq(const char *a, const char *b)
+{
+	if (!a || !b)
+		return a == b;
+	return strcmp(a, b) == 0;
+}
+
 static void
 print_chromaticity(const char *prefix, const struct di_chromaticity_cie1931 *c)
 {
@@ -34,14 +47,17 @@ print_info(const struct di_info *info)
 
 	str = di_info_get_make(info);
 	printf("make: %s\n", str_or_null(str));
+	assert(str_eq(str, di_info_peek_make(info)));
 	free(str);
 
 	str = di_info_get_model(info);
 	printf("model: %s\n", str_or_null(str));
+	assert(str_eq(str, di_info_peek_model(info)));
 	free(str);
 
 	str = di_info_get_serial(info);
 	printf("serial: %s\n", str_or_null(str));
+	assert(str_eq(str, di_info_peek_serial(info)));
 	free(str);
 
 	hdr_static = di_info_get_hdr_static_metadata(info);
@@ -83,6 +99,542 @@ print_info(const struct di_info *info)
 	if (ssc->ictcp)
 		printf(" ICtCp");
 	printf("\n");
+
+	printf("fingerprint: 0x%016" PRIx64 "\n", di_info_get_fingerprint(info));
+}
+
+static void
+check_summary_preferred_mode(const struct di_info *info,
+			     const struct di_info_summary *summary)
+{
+	const struct di_info_mode *modes, *m;
+	int32_t v_active;
+	size_t len, i;
+
+	/* The preferred timing must match its di_info_get_modes() entry */
+	v_active = summary->preferred_interlaced ? 2 * summary->preferred_vert_video :
+						   summary->preferred_vert_video;
+	modes = di_info_get_modes(info, &len);
+	for (i = 0; i < len; i++) {
+		m = &modes[i];
+		if (m->preferred && m->h_active == summary->preferred_horiz_video &&
+		    m->v_active == v_active &&
+		    m->pixel_clock_hz == summary->preferred_pixel_clock_hz)
+			break;
+	}
+	assert(i < len);
+	assert(summary->preferred_refresh_rate_hz == m->refresh_mhz / 1000.0);
+}
+
+static void
+print_summary(const struct di_info *info)
+{
+	struct di_info_summary summary;
+
+	di_info_get_summary(info, &summary);
+	if (summary.has_preferred_timing)
+		check_summary_preferred_mode(info, &summary);
+
+	assert(str_eq(summary.make, di_info_peek_make(info)));
+	assert(str_eq(summary.model, di_info_peek_model(info)));
+	assert(str_eq(summary.serial, di_info_peek_serial(info) ?
+		      di_info_peek_serial(info) : ""));
+	assert(summary.fingerprint == di_info_get_fingerprint(info));
+	assert(summary.default_gamma == di_info_get_default_gamma(info));
+	assert(memcmp(&summary.hdr_static_metadata,
+		      di_info_get_hdr_static_metadata(info),
+		      sizeof(summary.hdr_static_metadata)) == 0);
+
+	printf("screen size: %dx%d cm\n",
+	       summary.screen_width_cm, summary.screen_height_cm);
+
+	printf("preferred timing:");
+	if (summary.has_preferred_timing)
+		printf(" %dx%d%s @ %.3f Hz, %.3f MHz",
+		       summary.preferred_horiz_video,
+		       summary.preferred_vert_video,
+		       summary.preferred_interlaced ? "i" : "",
+		       summary.preferred_refresh_rate_hz,
+		       summary.preferred_pixel_clock_hz / 1e6);
+	printf("\n");
+
+	printf("range limits:");
+	if (summary.has_range_limits)
+		printf(" vert %d-%d Hz, horiz %d-%d kHz, max pixel clock %.3f MHz",
+		       summary.min_vert_rate_hz, summary.max_vert_rate_hz,
+		       summary.min_horiz_rate_hz / 1000,
+		       summary.max_horiz_rate_hz / 1000,
+		       (double) summary.max_pixel_clock_hz / 1e6);
+	printf("\n");
+
+	printf("extensions: CTA=%s, DisplayID=%s\n",
+	       yes_no(summary.has_cta), yes_no(summary.has_displayid));
+}
+
+static void
+print_vrr_range(const struct di_info *info)
+{
+	const struct di_info_vrr_range *vrr;
+
+	vrr = di_info_get_vrr_range(info);
+
+	printf("VRR range:");
+	if (vrr->sources == 0)
+		printf(" none");
+	else
+		printf(" %d-%d Hz", vrr->min_hz, vrr->max_hz);
+	if (vrr->sources & DI_INFO_VRR_SOURCE_EDID_RANGE_LIMITS)
+		printf(" RL");
+	if (vrr->sources & DI_INFO_VRR_SOURCE_HDMI)
+		printf(" HDMI");
+	printf("\n");
+}
+
+static void
+print_established_timings(const struct di_info *info)
+{
+	const struct di_edid *edid;
+	const struct di_dmt_timing *const *dmts;
+	size_t i;
+
+	edid = di_info_get_edid(info);
+	if (!edid)
+		return;
+
+	printf("established timings I/II DMT IDs:");
+	dmts = di_edid_get_established_timings_i_ii_dmts(edid);
+	if (!dmts[0])
+		printf(" none");
+	for (i = 0; dmts[i]; i++)
+		printf(" 0x%02x", dmts[i]->dmt_id);
+	printf("\n");
+}
+
+static void
+print_cta_svds(const struct di_edid_cta *cta)
+{
+	const struct di_cta_data_block *const *data_blocks;
+	const struct di_cta_svd *const *svds;
+	size_t i, j;
+	bool found = false;
+
+	printf("CTA YCbCr 4:2:0 VICs:");
+	data_blocks = di_edid_cta_get_data_blocks(cta);
+	for (i = 0; data_blocks[i]; i++) {
+		svds = di_cta_data_block_get_svds(data_blocks[i]);
+		if (!svds)
+			svds = di_cta_data_block_get_ycbcr420_svds(data_blocks[i]);
+		if (!svds)
+			continue;
+		for (j = 0; svds[j]; j++) {
+			assert(!svds[j]->ycbcr420_only || svds[j]->ycbcr420);
+			if (!svds[j]->ycbcr420)
+				continue;
+			printf(" %u%s", svds[j]->vic,
+			       svds[j]->ycbcr420_only ? " (only)" : "");
+			found = true;
+		}
+	}
+	if (!found)
+		printf(" none");
+	printf("\n");
+
+	printf("CTA unknown VICs:");
+	svds = di_edid_cta_get_unknown_svds(cta);
+	if (!svds[0])
+		printf(" none");
+	for (i = 0; svds[i]; i++) {
+		assert(svds[i]->video_format == NULL);
+		printf(" %u", svds[i]->vic);
+	}
+	printf("\n");
+}
+
+static void
+print_cta(const struct di_info *info)
+{
+	const struct di_edid *edid;
+	const struct di_edid_ext *const *exts;
+	const struct di_edid_cta *cta;
+	size_t i;
+
+	edid = di_info_get_edid(info);
+	if (!edid)
+		return;
+
+	exts = di_edid_get_extensions(edid);
+	for (i = 0; exts[i]; i++) {
+		cta = di_edid_ext_get_cta(exts[i]);
+		if (cta)
+			print_cta_svds(cta);
+	}
+}
+
+static void
+print_mode_list(const char *name, const struct di_info_mode *modes, size_t len)
+{
+	static const struct {
+		enum di_info_mode_source source;
+		const char *name;
+	} source_names[] = {
+		{ DI_INFO_MODE_SOURCE_EDID_DETAILED, "DTD" },
+		{ DI_INFO_MODE_SOURCE_EDID_STANDARD, "STD" },
+		{ DI_INFO_MODE_SOURCE_EDID_ESTABLISHED, "EST" },
+		{ DI_INFO_MODE_SOURCE_EDID_CVT, "CVT" },
+		{ DI_INFO_MODE_SOURCE_CTA_DETAILED, "CTA-DTD" },
+		{ DI_INFO_MODE_SOURCE_CTA_SVD, "SVD" },
+		{ DI_INFO_MODE_SOURCE_CTA_SVR, "SVR" },
+		{ DI_INFO_MODE_SOURCE_DISPLAYID, "DisplayID" },
+		{ DI_INFO_MODE_SOURCE_EDID_RANGE_LIMITS, "RL" },
+	};
+	const struct di_info_mode *m;
+	size_t i, j;
+	const char *sep;
+
+	printf("%s:", name);
+	if (len == 0)
+		printf(" none");
+	printf("\n");
+	for (i = 0; i < len; i++) {
+		m = &modes[i];
+		assert(m->sources != 0);
+		assert(i == 0 || !m->preferred || modes[i - 1].preferred);
+
+		printf("  %dx%d%s @ %.3f Hz, %.3f MHz", m->h_active, m->v_active,
+		       m->interlaced ? "i" : "", (double) m->refresh_mhz / 1000,
+		       (double) m->pixel_clock_hz / 1e6);
+		sep = " (";
+		for (j = 0; j < sizeof(source_names) / sizeof(source_names[0]); j++) {
+			if (!(m->sources & source_names[j].source))
+				continue;
+			printf("%s%s", sep, source_names[j].name);
+			sep = " ";
+		}
+		printf(")");
+		if (m->vic != 0)
+			printf(" VIC %u", m->vic);
+		if (m->dmt_id != 0)
+			printf(" DMT 0x%02x", m->dmt_id);
+		if (m->ycbcr420)
+			printf(" YCbCr420%s", m->ycbcr420_only ? "-only" : "");
+		if (m->preferred)
+			printf(" preferred");
+		printf("\n");
+	}
+}
+
+static void
+print_modes(const struct di_info *info)
+{
+	const struct di_info_mode *modes;
+	size_t len;
+
+	modes = di_info_get_modes(info, &len);
+	print_mode_list("modes", modes, len);
+
+	modes = di_info_get_implied_modes(info, &len);
+	print_mode_list("implied modes", modes, len);
+}
+
+static void
+print_link_modes(const struct di_info *info)
+{
+	const struct di_info_mode *modes, **filtered;
+	struct di_info_link_caps hdmi = {
+		.max_tmds_clock_hz = 340 * 1000 * 1000,
+	};
+	struct di_info_link_caps dp = {
+		.dp_lane_count = 4,
+		.dp_link_rate_mbps = 5400,
+		.bpc = 10,
+	};
+	size_t len;
+
+	modes = di_info_get_modes(info, &len);
+	filtered = calloc(len + 1, sizeof(filtered[0]));
+	assert(modes && filtered);
+
+	printf("modes fitting HDMI 340 MHz TMDS: RGB %zu",
+	       di_info_filter_modes(info, &hdmi, filtered));
+	hdmi.color_format = DI_INFO_LINK_COLOR_FORMAT_YCBCR420;
+	printf(", YCbCr 4:2:0 %zu\n", di_info_filter_modes(info, &hdmi, filtered));
+	printf("modes fitting DP HBR2 x4 at 10 bpc: RGB %zu\n",
+	       di_info_filter_modes(info, &dp, filtered));
+
+	free(filtered);
+}
+
+static void
+print_selected_mode(const char *name, const struct di_info *info,
+		    const struct di_info_mode_policy *policy)
+{
+	const struct di_info_mode *m;
+	enum di_info_link_color_format color_format;
+
+	printf("selected mode (%s):", name);
+	m = di_info_select_mode(info, policy, &color_format);
+	if (m)
+		printf(" %dx%d%s @ %.3f Hz%s", m->h_active, m->v_active,
+		       m->interlaced ? "i" : "", (double) m->refresh_mhz / 1000,
+		       color_format == DI_INFO_LINK_COLOR_FORMAT_YCBCR420 ?
+		       " YCbCr 4:2:0" : "");
+	else
+		printf(" none");
+	printf("\n");
+}
+
+static void
+print_selected_modes(const struct di_info *info)
+{
+	struct di_info_link_caps hdmi = {
+		.max_tmds_clock_hz = 340 * 1000 * 1000,
+	};
+	struct di_info_mode_policy policy = {
+		.flags = DI_INFO_MODE_POLICY_PREFER_NATIVE,
+		.link_caps = &hdmi,
+	};
+
+	print_selected_mode("native, HDMI 340 MHz TMDS", info, &policy);
+
+	hdmi.max_tmds_clock_hz = 600 * 1000 * 1000;
+	policy.flags = DI_INFO_MODE_POLICY_HDR | DI_INFO_MODE_POLICY_ALLOW_YCBCR420;
+	policy.max_refresh_mhz = 60500;
+	print_selected_mode("HDR up to 60 Hz, HDMI 600 MHz TMDS", info, &policy);
+}
+
+static void
+print_drm_modes(const struct di_info *info)
+{
+	struct di_info_drm_mode *drm_modes, *sentinel, first, *m;
+	size_t modes_len, len;
+
+	di_info_get_modes(info, &modes_len);
+	drm_modes = calloc(modes_len + 1, sizeof(drm_modes[0]));
+	sentinel = calloc(modes_len + 1, sizeof(sentinel[0]));
+	assert(drm_modes && sentinel);
+	len = di_info_get_drm_modes(info, drm_modes, modes_len);
+	assert(len <= modes_len);
+
+	/* Nothing is written past the provided length */
+	if (len > 0) {
+		first = drm_modes[0];
+		memset(sentinel, 0xA5, (modes_len + 1) * sizeof(sentinel[0]));
+		memcpy(&drm_modes[1], sentinel, modes_len * sizeof(drm_modes[0]));
+		assert(di_info_get_drm_modes(info, drm_modes, 1) == 1);
+		assert(memcmp(&drm_modes[0], &first, sizeof(first)) == 0);
+		assert(memcmp(&drm_modes[1], sentinel,
+			      modes_len * sizeof(drm_modes[0])) == 0);
+	}
+
+	printf("DRM modes: %zu\n", len);
+	if (len > 0) {
+		m = &drm_modes[0];
+		printf("  \"%s\" %" PRIu32 " %" PRIu16 " %" PRIu16 " %" PRIu16 " %" PRIu16
+		       " %" PRIu16 " %" PRIu16 " %" PRIu16 " %" PRIu16 " %" PRIu32
+		       " flags 0x%" PRIx32 " type 0x%" PRIx32 "\n",
+		       m->name, m->clock, m->hdisplay, m->hsync_start,
+		       m->hsync_end, m->htotal, m->vdisplay, m->vsync_start,
+		       m->vsync_end, m->vtotal, m->vrefresh, m->flags, m->type);
+	}
+
+	free(drm_modes);
+	free(sentinel);
+}
+
+static void
+print_tiled_display(const struct di_info *info)
+{
+	const struct di_info *infos[] = { info, info };
+	struct di_info_tile_groups *groups;
+	const struct di_info_tiled_display *const *displays;
+	const struct di_info_tiled_display *display;
+	const struct di_info_tile *tile;
+	size_t i;
+
+	groups = di_info_group_tiles(infos, 1);
+	assert(groups);
+	displays = di_info_tile_groups_get_displays(groups);
+
+	printf("tiled display:");
+	display = displays[0];
+	if (!display) {
+		printf(" none\n");
+	} else {
+		printf(" %.3s %" PRIu16 " %" PRIu32 ", %dx%d tiles, %dx%d @ %.3f Hz, %s\n",
+		       display->vendor_id, display->product_code,
+		       display->serial_number, display->total_horiz_tiles,
+		       display->total_vert_tiles, display->width, display->height,
+		       display->refresh_mhz / 1000.0,
+		       display->complete ? "complete" : "incomplete");
+		for (i = 0; i < display->tiles_len; i++) {
+			tile = &display->tiles[i];
+			printf("  tile %d,%d: %dx%d+%d+%d\n",
+			       tile->horiz_tile_location, tile->vert_tile_location,
+			       tile->width, tile->height, tile->x, tile->y);
+		}
+	}
+	assert(!display || !displays[1]);
+	di_info_tile_groups_destroy(groups);
+
+	/* The same display device twice is a single tiled display with a
+	 * duplicate tile */
+	groups = di_info_group_tiles(infos, 2);
+	assert(groups);
+	displays = di_info_tile_groups_get_displays(groups);
+	assert(!displays[0] == !display);
+	assert(!displays[0] || (displays[0]->tiles_len == 2 &&
+				!displays[0]->complete && !displays[1]));
+	di_info_tile_groups_destroy(groups);
+}
+
+static void
+check_supports_modes(const struct di_info *info)
+{
+	const struct di_info_mode *modes;
+	struct di_info_mode_query *queries;
+	bool *supported;
+	size_t len, i;
+
+	/* Every listed mode must be found by the index */
+	modes = di_info_get_modes(info, &len);
+	queries = calloc(len + 1, sizeof(queries[0]));
+	supported = calloc(len + 1, sizeof(supported[0]));
+	assert(queries && supported);
+	for (i = 0; i < len; i++) {
+		queries[i].h_active = modes[i].h_active;
+		queries[i].v_active = modes[i].v_active;
+		queries[i].refresh_mhz = modes[i].refresh_mhz;
+		if (modes[i].interlaced)
+			queries[i].flags |= DI_INFO_MODE_QUERY_INTERLACED;
+		assert(di_info_supports_mode(info, modes[i].h_active,
+					     modes[i].v_active, 0,
+					     queries[i].flags));
+	}
+	queries[len].h_active = 1;
+	queries[len].v_active = 1;
+	assert(di_info_supports_modes(info, queries, len + 1, supported) == len);
+	assert(!supported[len]);
+
+	free(queries);
+	free(supported);
+}
+
+static void
+check_modes_soa(const struct di_info *info)
+{
+	const struct di_info_mode *modes;
+	struct di_info_modes_soa soa;
+	size_t len, i;
+
+	modes = di_info_get_modes(info, &len);
+	di_info_get_modes_soa(info, &soa);
+	assert(soa.len == len);
+	assert((uintptr_t) soa.h_active % 64 == 0);
+	assert((uintptr_t) soa.flags % 64 == 0);
+	for (i = 0; i < len; i++) {
+		assert(soa.h_active[i] == (uint32_t) modes[i].h_active);
+		assert(soa.v_active[i] == (uint32_t) modes[i].v_active);
+		assert(soa.pixel_clock_khz[i] == (uint32_t) ((modes[i].pixel_clock_hz + 500) / 1000));
+		assert(soa.refresh_mhz[i] == (uint32_t) modes[i].refresh_mhz);
+		assert(!(soa.flags[i] & DI_INFO_MODES_SOA_PREFERRED) == !modes[i].preferred);
+		assert(!(soa.flags[i] & DI_INFO_MODES_SOA_INTERLACED) == !modes[i].interlaced);
+	}
+	/* Padding up to the next aligned block is zeroed */
+	for (; i % 16 != 0; i++)
+		assert(soa.h_active[i] == 0 && soa.flags[i] == 0);
+}
+
+static void
+check_self_diff(const struct di_info *info, const void *data, size_t size)
+{
+	struct di_info *other;
+	struct di_info_diff diff;
+
+	/* Parsing the same blob twice must not yield any difference */
+	other = di_info_parse_edid(data, size);
+	assert(other);
+	di_info_diff(info, other, &diff);
+	assert(diff.sections == 0);
+	assert(diff.cta_data_block_tags == 0);
+	assert(diff.displayid_data_block_tags == 0);
+	di_info_destroy(other);
+}
+
+static struct di_info *
+parse_edid_file(const char *path)
+{
+	FILE *in;
+	static uint8_t raw[32 * 1024];
+	size_t size = 0;
+	struct di_info *info;
+
+	in = fopen(path, "r");
+	if (!in) {
+		perror("failed to open input file");
+		return NULL;
+	}
+
+	while (!feof(in)) {
+		size += fread(&raw[size], 1, sizeof(raw) - size, in);
+		if (ferror(in)) {
+			perror("fread failed");
+			fclose(in);
+			return NULL;
+		} else if (size >= sizeof(raw)) {
+			fprintf(stderr, "input too large\n");
+			fclose(in);
+			return NULL;
+		}
+	}
+
+	fclose(in);
+
+	info = di_info_parse_edid(raw, size);
+	if (!info)
+		perror("di_edid_parse failed");
+	return info;
+}
+
+/**
+ * Compare two EDIDs with di_info_diff(), in both orders, and check the
+ * result against the expected bitfields.
+ *
+ * Arguments: <a.edid> <b.edid> <sections> <CTA tags> <DisplayID tags>
+ */
+static int
+check_diff(char *argv[])
+{
+	struct di_info *a, *b;
+	struct di_info_diff diff, reverse;
+	unsigned long sections, cta_tags, displayid_tags;
+	int ret = 0;
+
+	sections = strtoul(argv[2], NULL, 0);
+	cta_tags = strtoul(argv[3], NULL, 0);
+	displayid_tags = strtoul(argv[4], NULL, 0);
+
+	a = parse_edid_file(argv[0]);
+	b = parse_edid_file(argv[1]);
+	if (!a || !b)
+		return 1;
+
+	di_info_diff(a, b, &diff);
+	di_info_diff(b, a, &reverse);
+	assert(memcmp(&diff, &reverse, sizeof(diff)) == 0);
+
+	if (diff.sections != sections ||
+	    diff.cta_data_block_tags != cta_tags ||
+	    diff.displayid_data_block_tags != displayid_tags) {
+		fprintf(stderr, "unexpected diff: sections 0x%" PRIx32
+			", CTA tags 0x%" PRIx32 ", DisplayID tags 0x%" PRIx32 "\n",
+			diff.sections, diff.cta_data_block_tags,
+			diff.displayid_data_block_tags);
+		ret = 1;
+	}
+
+	di_info_destroy(a);
+	di_info_destroy(b);
+	return ret;
 }
 
 int
@@ -93,6 +645,9 @@ main(int argc, char *argv[])
 	size_t size = 0;
 	struct di_info *info;
 
+	if (argc == 7 && strcmp(argv[1], "--diff") == 0)
+		return check_diff(&argv[2]);
+
 	in = stdin;
 	if (argc > 1) {
 		in = fopen(argv[1], "r");
@@ -122,6 +677,18 @@ main(int argc, char *argv[])
 	}
 
 	print_info(info);
+	print_summary(info);
+	print_vrr_range(info);
+	print_established_timings(info);
+	print_cta(info);
+	print_modes(info);
+	print_link_modes(info);
+	print_selected_modes(info);
+	print_drm_modes(info);
+	print_tiled_display(info);
+	check_supports_modes(info);
+	check_modes_soa(info);
+	check_self_diff(info, raw, size);
 	di_info_destroy(info);
 
 	return 0;
@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 
 import os
+import re
 import subprocess
 import sys
 
@@ -12,6 +13,7 @@ in_basename = os.path.basename(in_path)
 
 tool_dir = os.path.dirname(os.path.realpath(__file__))
 out_path = tool_dir + "/../cta-vic-table.c"
+dmt_path = tool_dir + "/../dmt-table.c"
 
 # Page numbers for CTA-861-H
 pages = {
@@ -119,25 +121,113 @@ for page in extract_pages(pages["sync"]):
 for page in extract_pages(pages["aspect_ratio"]):
     parse_aspect_ratio_table(page, format_table)
 
-max_vic = 0
-for vic in format_table:
-    if vic > max_vic:
-        max_vic = vic
-
 # Sanity check
 for vic in format_table:
     fmt = format_table[vic]
     assert("h_sync" in fmt)
     assert("picture_aspect_ratio" in fmt)
+    assert(0 < vic < 256)
+    assert(fmt["h_active"] < 1 << 16 and fmt["v_active"] < 1 << 16)
+    assert(fmt["pixel_clock_hz"] % 1000 == 0)
+    assert(fmt["pixel_clock_hz"] // 1000 < 1 << 32)
+
+def parse_dmt_table(path):
+    # Read back the DMT timings emitted by gen-dmt.py
+    with open(path) as f:
+        src = f.read()
+    body = src.split("_di_dmt_timings[] = {")[1].split("\n};")[0] + "\n"
+    timings = []
+    for block in re.findall(r"\t\{\n(.*?)\t\},\n", body, re.S):
+        t = {}
+        for k, v in re.findall(r"\t\t\.(\w+) = ([^,]+),", block):
+            if k not in ("refresh_rate_hz", "reduced_blanking"):
+                v = int(v, 0)
+            t[k] = v
+        timings.append(t)
+    return timings
+
+def same_timing(fmt, dmt):
+    # DMT borders are part of the blanking on the wire
+    h_border = dmt["horiz_border"]
+    v_border = dmt["vert_border"]
+    return fmt["interlaced"] == "false" and \
+        fmt["h_active"] == dmt["horiz_video"] and \
+        fmt["v_active"] == dmt["vert_video"] and \
+        fmt["pixel_clock_hz"] == dmt["pixel_clock_hz"] and \
+        fmt["h_front"] == dmt["horiz_front_porch"] + h_border and \
+        fmt["h_sync"] == dmt["horiz_sync_pulse"] and \
+        fmt["h_back"] == dmt["horiz_blank"] - dmt["horiz_front_porch"] - dmt["horiz_sync_pulse"] + h_border and \
+        fmt["v_front"] == dmt["vert_front_porch"] + v_border and \
+        fmt["v_sync"] == dmt["vert_sync_pulse"] and \
+        fmt["v_back"] == dmt["vert_blank"] - dmt["vert_front_porch"] - dmt["vert_sync_pulse"] + v_border
+
+dmt_timings = parse_dmt_table(dmt_path)
+
+vics = sorted(format_table)
+formats = [format_table[vic] for vic in vics]
+
+def write_array(f, c_type, name, values):
+    f.write("const {} {}[] = {{\n".format(c_type, name))
+    for v in values:
+        f.write("\t{},\n".format(v))
+    f.write("};\n\n")
 
+# The tables must only contain integers and enum constants: pointers would
+# require dynamic relocations when the library is loaded.
 with open(out_path, "w+") as f:
     f.write("/* DO NOT EDIT! This file has been generated by gen-cta-vic.py from {}. */\n\n".format(in_basename))
     f.write('#include "cta.h"\n\n')
     f.write("const struct di_cta_video_format _di_cta_video_formats[] = {\n")
-    for vic in format_table:
-        f.write("\t[{}] = {{\n".format(vic))
-        for k, v in format_table[vic].items():
+    for fmt in formats:
+        f.write("\t{\n")
+        for k, v in fmt.items():
             f.write("\t\t.{} = {},\n".format(k, v))
         f.write("\t},\n")
     f.write("};\n\n")
-    f.write("const size_t _di_cta_video_formats_len = {};\n".format(max_vic + 1))
+    f.write("const size_t _di_cta_video_formats_len = {};\n\n".format(len(formats)))
+
+    # Index into _di_cta_video_formats plus one, zero for unknown VICs
+    f.write("const uint8_t _di_cta_video_formats_by_vic[256] = {\n")
+    for i, vic in enumerate(vics):
+        f.write("\t[{}] = {},\n".format(vic, i + 1))
+    f.write("};\n\n")
+
+    # Hot fields as narrow structure-of-arrays, indexed like _di_cta_video_formats
+    write_array(f, "uint16_t", "_di_cta_video_formats_h_active",
+                [fmt["h_active"] for fmt in formats])
+    write_array(f, "uint16_t", "_di_cta_video_formats_v_active",
+                [fmt["v_active"] for fmt in formats])
+    write_array(f, "uint32_t", "_di_cta_video_formats_pixel_clock_khz",
+                [fmt["pixel_clock_hz"] // 1000 for fmt in formats])
+
+    # Indices into _di_cta_video_formats sorted by resolution
+    by_res = sorted(range(len(formats)),
+                    key=lambda i: (formats[i]["h_active"], formats[i]["v_active"], i))
+    f.write("const uint8_t _di_cta_video_formats_by_res[] = {\n")
+    for i in by_res:
+        f.write("\t{}, /* VIC {}: {}x{} */\n".format(i, formats[i]["vic"], formats[i]["h_active"], formats[i]["v_active"]))
+    f.write("};\n\n")
+
+    # Cross-reference with the DMT timings which have identical timings. If
+    # several VICs match a DMT timing, the lowest one is used.
+    dmt_ids = []
+    vic_by_dmt_id = {}
+    for fmt in formats:
+        dmt_id = 0
+        for dmt in dmt_timings:
+            if same_timing(fmt, dmt):
+                dmt_id = dmt["dmt_id"]
+                vic_by_dmt_id.setdefault(dmt_id, fmt["vic"])
+                break
+        dmt_ids.append(dmt_id)
+    f.write("const uint8_t _di_cta_video_formats_dmt_id[] = {\n")
+    for fmt, dmt_id in zip(formats, dmt_ids):
+        if dmt_id != 0:
+            f.write("\t0x{:02X}, /* VIC {} */\n".format(dmt_id, fmt["vic"]))
+        else:
+            f.write("\t0,\n")
+    f.write("};\n\n")
+    f.write("const uint8_t _di_cta_vic_by_dmt_id[256] = {\n")
+    for dmt_id, vic in sorted(vic_by_dmt_id.items()):
+        f.write("\t[0x{:02X}] = {},\n".format(dmt_id, vic))
+    f.write("};\n")
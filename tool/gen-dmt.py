@@ -115,6 +115,100 @@ def parse_timing(page):
         "reduced_blanking": "true" if reduced_blanking else "false",
     }
 
+# DMT IDs of the established timings I and II, one entry per bit starting with
+# bit 7 of byte 0x23 (EDID section 3.8). None for timings which aren't DMT
+# timings.
+established_timings_i_ii = [
+    # 0x23
+    None, # 720 x 400 @ 70 Hz (IBM, VGA)
+    None, # 720 x 400 @ 88 Hz (IBM, XGA2)
+    0x04, # 640 x 480 @ 60 Hz (IBM, VGA)
+    None, # 640 x 480 @ 67 Hz (Apple, Mac II)
+    0x05, # 640 x 480 @ 72 Hz (VESA)
+    0x06, # 640 x 480 @ 75 Hz (VESA)
+    0x08, # 800 x 600 @ 56 Hz (VESA)
+    0x09, # 800 x 600 @ 60 Hz (VESA)
+    # 0x24
+    0x0a, # 800 x 600 @ 72 Hz (VESA)
+    0x0b, # 800 x 600 @ 75 Hz (VESA)
+    None, # 832 x 624 @ 75 Hz (Apple, Mac II)
+    0x0f, # 1024 x 768 @ 87 Hz interlaced (IBM)
+    0x10, # 1024 x 768 @ 60 Hz (VESA)
+    0x11, # 1024 x 768 @ 70 Hz (VESA)
+    0x12, # 1024 x 768 @ 75 Hz (VESA)
+    0x24, # 1280 x 1024 @ 75 Hz (VESA)
+    # 0x25
+    None, # 1152 x 870 @ 75 Hz (Apple, Mac II)
+]
+
+# DMT IDs of the established timings III, one entry per bit starting with
+# bit 7 of byte 0x06 of the display descriptor (EDID section 3.10.3.9)
+established_timings_iii = [
+    # 0x06
+    0x01, # 640 x 350 @ 85 Hz
+    0x02, # 640 x 400 @ 85 Hz
+    0x03, # 720 x 400 @ 85 Hz
+    0x07, # 640 x 480 @ 85 Hz
+    0x0e, # 848 x 480 @ 60 Hz
+    0x0c, # 800 x 600 @ 85 Hz
+    0x13, # 1024 x 768 @ 85 Hz
+    0x15, # 1152 x 864 @ 75 Hz
+    # 0x07
+    0x16, # 1280 x 768 @ 60 Hz (RB)
+    0x17, # 1280 x 768 @ 60 Hz
+    0x18, # 1280 x 768 @ 75 Hz
+    0x19, # 1280 x 768 @ 85 Hz
+    0x20, # 1280 x 960 @ 60 Hz
+    0x21, # 1280 x 960 @ 85 Hz
+    0x23, # 1280 x 1024 @ 60 Hz
+    0x25, # 1280 x 1024 @ 85 Hz
+    # 0x08
+    0x27, # 1360 x 768 @ 60 Hz
+    0x2e, # 1440 x 900 @ 60 Hz (RB)
+    0x2f, # 1440 x 900 @ 60 Hz
+    0x30, # 1440 x 900 @ 75 Hz
+    0x31, # 1440 x 900 @ 85 Hz
+    0x29, # 1400 x 1050 @ 60 Hz (RB)
+    0x2a, # 1400 x 1050 @ 60 Hz
+    0x2b, # 1400 x 1050 @ 75 Hz
+    # 0x09
+    0x2c, # 1400 x 1050 @ 85 Hz
+    0x39, # 1680 x 1050 @ 60 Hz (RB)
+    0x3a, # 1680 x 1050 @ 60 Hz
+    0x3b, # 1680 x 1050 @ 75 Hz
+    0x3c, # 1680 x 1050 @ 85 Hz
+    0x33, # 1600 x 1200 @ 60 Hz
+    0x34, # 1600 x 1200 @ 65 Hz
+    0x35, # 1600 x 1200 @ 70 Hz
+    # 0x0a
+    0x36, # 1600 x 1200 @ 75 Hz
+    0x37, # 1600 x 1200 @ 85 Hz
+    0x3e, # 1792 x 1344 @ 60 Hz
+    0x3f, # 1792 x 1344 @ 75 Hz
+    0x41, # 1856 x 1392 @ 60 Hz
+    0x42, # 1856 x 1392 @ 75 Hz
+    0x44, # 1920 x 1200 @ 60 Hz (RB)
+    0x45, # 1920 x 1200 @ 60 Hz
+    # 0x0b
+    0x46, # 1920 x 1200 @ 75 Hz
+    0x47, # 1920 x 1200 @ 85 Hz
+    0x49, # 1920 x 1440 @ 60 Hz
+    0x4a, # 1920 x 1440 @ 75 Hz
+]
+
+def write_established_timings(f, name, dmt_ids):
+    index_by_id = {int(t["dmt_id"], 16): i for i, t in enumerate(timings)}
+    f.write("const uint8_t {}[{}] = {{\n".format(name, len(dmt_ids)))
+    for dmt_id in dmt_ids:
+        if dmt_id is None:
+            f.write("\t0,\n")
+            continue
+        t = timings[index_by_id[dmt_id]]
+        f.write("\t{}, /* {}x{} @ {} Hz{} */\n".format(index_by_id[dmt_id] + 1,
+                t["horiz_video"], t["vert_video"], int(float(t["refresh_rate_hz"])),
+                " (RB)" if t["reduced_blanking"] == "true" else ""))
+    f.write("};\n")
+
 if len(sys.argv) != 2:
     print("usage: gen-dmt.py <DMT PDF>", file=sys.stderr)
     sys.exit(1)
@@ -136,6 +230,8 @@ for l in subprocess.check_output(cmd, text=True):
     else:
         page += l
 
+# The tables must only contain integers and enum constants: pointers would
+# require dynamic relocations when the library is loaded.
 with open(out_path, "w+") as f:
     f.write("/* DO NOT EDIT! This file has been generated by gen-dmt.py from {}. */\n\n".format(in_basename))
     f.write('#include "dmt.h"\n\n')
@@ -146,4 +242,35 @@ with open(out_path, "w+") as f:
             f.write("\t\t.{} = {},\n".format(k, v))
         f.write("\t},\n")
     f.write("};\n\n")
-    f.write("const size_t _di_dmt_timings_len = {};\n".format(len(timings)))
+    f.write("const size_t _di_dmt_timings_len = {};\n\n".format(len(timings)))
+
+    # Index into _di_dmt_timings plus one, zero for unknown DMT IDs
+    assert(len(timings) < 256)
+    f.write("const uint8_t _di_dmt_timings_by_id[256] = {\n")
+    for i, t in enumerate(timings):
+        f.write("\t[{}] = {},\n".format(t["dmt_id"], i + 1))
+    f.write("};\n\n")
+
+    # Index into _di_dmt_timings sorted by standard timing 2-byte code
+    std_ids = sorted(((t["edid_std_id"], i) for i, t in enumerate(timings)
+                      if t["edid_std_id"] != 0), key=lambda e: int(e[0], 16))
+    assert(len(set(int(k, 16) for k, _ in std_ids)) == len(std_ids))
+    f.write("const struct di_dmt_std_id_index _di_dmt_std_ids[] = {\n")
+    for k, i in std_ids:
+        f.write("\t{{ {}, {} }},\n".format(k, i))
+    f.write("};\n\n")
+    f.write("const size_t _di_dmt_std_ids_len = {};\n\n".format(len(std_ids)))
+
+    # Indices into _di_dmt_timings sorted by resolution
+    by_res = sorted(range(len(timings)),
+                    key=lambda i: (timings[i]["horiz_video"], timings[i]["vert_video"], i))
+    f.write("const uint8_t _di_dmt_timings_by_res[] = {\n")
+    for i in by_res:
+        f.write("\t{}, /* {}x{} */\n".format(i, timings[i]["horiz_video"], timings[i]["vert_video"]))
+    f.write("};\n\n")
+
+    # Index into _di_dmt_timings plus one for each established timing bit,
+    # zero if the established timing isn't a DMT timing
+    write_established_timings(f, "_di_dmt_established_timings_i_ii", established_timings_i_ii)
+    f.write("\n")
+    write_established_timings(f, "_di_dmt_established_timings_iii", established_timings_iii)
@@ -29,9 +29,11 @@ SOFTWARE.
 
 import sys
 
-def escape_for_c(s):
-    l = [c if c.isalnum() or c in ' .,' else '\\%03o' % ord(c) for c in s]
-    return ''.join(l)
+def escape_byte_for_c(b):
+    c = chr(b)
+    if b < 0x80 and (c.isalnum() or c in ' .,'):
+        return c
+    return '\\%03o' % b
 
 if len(sys.argv) != 4:
     print('usage: ' + sys.argv[0] + ' <infile> <outfile> <ident>', file=sys.stderr)
@@ -51,7 +53,35 @@ with open(infile, 'r') as f:
             print("Warning: skipping invalid PNP ID %s" % (repr(pnpid)), file=sys.stderr)
             continue
 
-        records[pnpid] = escape_for_c(name.strip())
+        records[pnpid] = name.strip()
+
+# The lookup below reads the first key unconditionally, and ISO C doesn't
+# allow empty array initializers anyway
+if not records:
+    print('Error: no records found in %s' % infile, file=sys.stderr)
+    sys.exit(1)
+
+def key_to_u32(key):
+    u = 0
+    for c in key:
+        u = (u << 8) | ord(c)
+    return u
+
+keys = sorted(records.keys(), key=key_to_u32)
+
+# All values are concatenated into a single NUL-separated string pool, so
+# that the table contains no pointers and needs no dynamic relocations when
+# the library is loaded. Keep it that way.
+offsets = []
+pool_len = 0
+for key in keys:
+    offsets.append(pool_len)
+    pool_len += len(records[key].encode('utf-8')) + 1
+assert pool_len < 1 << 32
+
+def pool_entry(value):
+    chars = ["'" + escape_byte_for_c(b) + "'" for b in value.encode('utf-8')]
+    return ', '.join(chars + ['0'])
 
 with open(outfile, 'w') as f:
     f.write(
@@ -62,12 +92,36 @@ f'''
 const char *
 {ident}(const char *key);
 
+static const uint32_t {ident}_keys[] = {{
+''')
+    for key in keys:
+        f.write(f'    {key_to_u32(key)},\n')
+    f.write(
+f'''}};
+
+static const uint32_t {ident}_offsets[] = {{
+''')
+    for off in offsets:
+        f.write(f'    {off},\n')
+    f.write(
+f'''}};
+
+/* A char array rather than a string literal, which would exceed the maximum
+ * length required by ISO C */
+static const char {ident}_pool[] = {{
+''')
+    for key in keys:
+        f.write(f'    {pool_entry(records[key])},\n')
+    f.write(
+f'''}};
+
 const char *
 {ident}(const char *key)
 {{
     size_t len = strlen(key);
-    size_t i;
+    size_t i, n, half;
     uint32_t u = 0;
+    const uint32_t *base;
 
     if (len > 4)
         return NULL;
@@ -75,17 +129,17 @@ const char *
     for (i = 0; i < len; i++)
         u = (u << 8) | (uint8_t)key[i];
 
-    switch (u) {{
-''')
-    for id in sorted(records.keys()):
-        u = 0
-        for c in id:
-            u = (u << 8) | ord(c)
-        f.write(f'    case {u}: return "{records[id]}";\n')
-    f.write(
-f'''
-    default:
-        return NULL;
+    /* Branch-free binary search for the last key less than or equal to u */
+    base = {ident}_keys;
+    n = sizeof({ident}_keys) / sizeof({ident}_keys[0]);
+    while (n > 1) {{
+        half = n / 2;
+        base = base[half] <= u ? base + half : base;
+        n -= half;
     }}
+
+    if (*base != u)
+        return NULL;
+    return &{ident}_pool[{ident}_offsets[base - {ident}_keys]];
 }}
 ''')